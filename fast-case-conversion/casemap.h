@@ -0,0 +1,298 @@
+/*
+ *	Fast character case conversion
+ *	https://github.com/apankrat/notes/blob/master/fast-case-conversion
+ */
+#ifndef _CASEMAP_H_
+#define _CASEMAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+#include <uchar.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ *	The tables store 16-bit deltas and rely on them wrapping
+ *	around at 0x10000, i.e. they need a 16-bit wchar_t. This
+ *	is a given on Windows, use -fshort-wchar with gcc/clang
+ *	elsewhere.
+ */
+typedef char casemap_wchar_must_be_16_bit[ sizeof(wchar_t) == 2 ? 1 : -1 ];
+
+/*
+ *	The tables, see tolower_*.c and toupper_*.c
+ */
+extern const uint8_t  casemap_l_1618_idx1[];
+extern const uint16_t casemap_l_1618_off1[];
+extern const uint8_t  casemap_l_1618_idx2[];
+extern const uint16_t casemap_l_1618_off2[];
+extern const wchar_t  casemap_l_1618_dat[];
+
+extern const wchar_t  casemap_l_2112[];
+
+extern const uint8_t  casemap_l_4422_idx[];
+extern const uint16_t casemap_l_4422_off[];
+extern const wchar_t  casemap_l_4422_dat[];
+
+extern const wchar_t  casemap_l_5750[];
+
+extern const uint8_t  casemap_u_1738_idx1[];
+extern const uint16_t casemap_u_1738_off1[];
+extern const uint8_t  casemap_u_1738_idx2[];
+extern const uint16_t casemap_u_1738_off2[];
+extern const wchar_t  casemap_u_1738_dat[];
+
+extern const wchar_t  casemap_u_2258[];
+
+extern const uint8_t  casemap_u_4638_idx[];
+extern const uint16_t casemap_u_4638_off[];
+extern const wchar_t  casemap_u_4638_dat[];
+
+extern const wchar_t  casemap_u_5866[];
+
+extern const uint8_t  casemap_l_astral_idx0[];
+extern const uint16_t casemap_l_astral_off0[];
+extern const uint8_t  casemap_l_astral_idx1[];
+extern const uint16_t casemap_l_astral_off1[];
+extern const uint8_t  casemap_l_astral_idx2[];
+extern const uint16_t casemap_l_astral_off2[];
+extern const uint16_t casemap_l_astral_dat[];
+
+extern const uint8_t  casemap_u_astral_idx0[];
+extern const uint16_t casemap_u_astral_off0[];
+extern const uint8_t  casemap_u_astral_idx1[];
+extern const uint16_t casemap_u_astral_off1[];
+extern const uint8_t  casemap_u_astral_idx2[];
+extern const uint16_t casemap_u_astral_off2[];
+extern const uint16_t casemap_u_astral_dat[];
+
+extern const uint8_t  casemap_p_8358_idx[];
+extern const uint16_t casemap_p_8358_off[];
+extern const wchar_t  casemap_p_8358_dat[];
+
+extern const wchar_t  casemap_l_latin1[];
+extern const wchar_t  casemap_u_latin1[];
+
+extern const wchar_t  casemap_f_6208[];
+extern const wchar_t  casemap_f_6208_exp[];
+
+/*
+ *	Single character lookups, verbatim from the table files
+ */
+static inline wchar_t tolower_1618(wchar_t ch)
+{
+	size_t block = casemap_l_1618_idx2[ casemap_l_1618_off1[ casemap_l_1618_idx1[ch >> 8] ] + ((ch >> 3) & 0x1f) ];
+	return ch + casemap_l_1618_dat[ casemap_l_1618_off2[ block ] + (ch & 0x07) ];
+}
+
+static inline wchar_t tolower_2112(wchar_t ch)
+{
+	return ch + casemap_l_2112[ casemap_l_2112[ casemap_l_2112[ch >> 8] + ((ch >> 3) & 0x1f) ] + (ch & 0x07) ];
+}
+
+static inline wchar_t tolower_4422(wchar_t ch)
+{
+	return ch + casemap_l_4422_dat[ casemap_l_4422_off[ casemap_l_4422_idx[ch >> 5] ] + (ch & 0x1f) ];
+}
+
+static inline wchar_t tolower_5750(wchar_t ch)
+{
+	return ch + casemap_l_5750[ casemap_l_5750[ch >> 6] + (ch & 0x3f) ];
+}
+
+static inline wchar_t toupper_1738(wchar_t ch)
+{
+	size_t block = casemap_u_1738_idx2[ casemap_u_1738_off1[ casemap_u_1738_idx1[ch >> 8] ] + ((ch >> 3) & 0x1f) ];
+	return ch + casemap_u_1738_dat[ casemap_u_1738_off2[ block ] + (ch & 0x07) ];
+}
+
+static inline wchar_t toupper_2258(wchar_t ch)
+{
+	return ch + casemap_u_2258[ casemap_u_2258[ casemap_u_2258[ch >> 8] + ((ch >> 3) & 0x1f) ] + (ch & 0x07) ];
+}
+
+static inline wchar_t toupper_4638(wchar_t ch)
+{
+	return ch + casemap_u_4638_dat[ casemap_u_4638_off[ casemap_u_4638_idx[ch >> 5] ] + (ch & 0x1f) ];
+}
+
+static inline wchar_t toupper_5866(wchar_t ch)
+{
+	return ch + casemap_u_5866[ casemap_u_5866[ch >> 6] + (ch & 0x3f) ];
+}
+
+/*
+ *	Lower and upper case from one table, see casepair_8358.c
+ *
+ *	Same layout as 4422, but with both deltas side by side in each
+ *	slot, so that one index walk gives both cases. It's smaller than
+ *	4422 and 4638 together and keeps code that does both to half as
+ *	many cache lines.
+ */
+static inline void casepair_8358(wchar_t ch, wchar_t * lower, wchar_t * upper)
+{
+	const wchar_t * p = casemap_p_8358_dat + casemap_p_8358_off[ casemap_p_8358_idx[ch >> 4] ] + ((ch & 0x0f) << 1);
+	*lower = ch + p[0];
+	*upper = ch + p[1];
+}
+
+static inline wchar_t tolower_8358(wchar_t ch)
+{
+	return ch + casemap_p_8358_dat[ casemap_p_8358_off[ casemap_p_8358_idx[ch >> 4] ] + ((ch & 0x0f) << 1) ];
+}
+
+static inline wchar_t toupper_8358(wchar_t ch)
+{
+	return ch + casemap_p_8358_dat[ casemap_p_8358_off[ casemap_p_8358_idx[ch >> 4] ] + ((ch & 0x0f) << 1) + 1 ];
+}
+
+/*
+ *	Tiered lookups - U+0000 - U+00FF from a direct 256-entry table,
+ *	see to*_latin1.c, everything else from the 4422 / 4638 tables.
+ *
+ *	The branchy version is a single load for Latin-1 and it's the
+ *	one to use when text is mostly Latin-1 and the branch predicts
+ *	well. The branch-free one does both lookups and picks with a
+ *	mask, which only pays off on text that mixes the two a lot.
+ */
+static inline wchar_t tolower_tiered(wchar_t ch)
+{
+	return (ch < 0x100) ? casemap_l_latin1[ch] : tolower_4422(ch);
+}
+
+static inline wchar_t toupper_tiered(wchar_t ch)
+{
+	return (ch < 0x100) ? casemap_u_latin1[ch] : toupper_4638(ch);
+}
+
+static inline wchar_t tolower_tiered_bf(wchar_t ch)
+{
+	wchar_t mask = (wchar_t)0 - (wchar_t)(ch < 0x100);
+	return (casemap_l_latin1[ch & 0xff] & mask) | (tolower_4422(ch) & ~mask);
+}
+
+static inline wchar_t toupper_tiered_bf(wchar_t ch)
+{
+	wchar_t mask = (wchar_t)0 - (wchar_t)(ch < 0x100);
+	return (casemap_u_latin1[ch & 0xff] & mask) | (toupper_4638(ch) & ~mask);
+}
+
+/*
+ *	Supplementary planes, U+10000 - U+10FFFF, see to*_astral.c
+ *
+ *	Same idea as 1618 / 1738, but with one more index level on
+ *	top, so that the 16 planes that are mostly empty collapse into
+ *	a handful of bytes. Deltas are signed 16-bit.
+ */
+static inline char32_t tolower_astral(char32_t ch)
+{
+	size_t seq   = casemap_l_astral_idx1[ casemap_l_astral_off0[ casemap_l_astral_idx0[ch >> 14] ] + ((ch >> 8) & 0x3f) ];
+	size_t block = casemap_l_astral_idx2[ casemap_l_astral_off1[ seq ] + ((ch >> 3) & 0x1f) ];
+	return ch + (int16_t)casemap_l_astral_dat[ casemap_l_astral_off2[ block ] + (ch & 0x07) ];
+}
+
+static inline char32_t toupper_astral(char32_t ch)
+{
+	size_t seq   = casemap_u_astral_idx1[ casemap_u_astral_off0[ casemap_u_astral_idx0[ch >> 14] ] + ((ch >> 8) & 0x3f) ];
+	size_t block = casemap_u_astral_idx2[ casemap_u_astral_off1[ seq ] + ((ch >> 3) & 0x1f) ];
+	return ch + (int16_t)casemap_u_astral_dat[ casemap_u_astral_off2[ block ] + (ch & 0x07) ];
+}
+
+/*
+ *	Full code point range - the BMP goes through the 5750 / 5866
+ *	tables, the rest through the astral ones. Values past U+10FFFF
+ *	are returned as is.
+ */
+static inline char32_t tolower32(char32_t ch)
+{
+	if (ch < 0x10000)
+		return tolower_5750((wchar_t)ch);
+
+	return (ch < 0x110000) ? tolower_astral(ch) : ch;
+}
+
+static inline char32_t toupper32(char32_t ch)
+{
+	if (ch < 0x10000)
+		return toupper_5866((wchar_t)ch);
+
+	return (ch < 0x110000) ? toupper_astral(ch) : ch;
+}
+
+/*
+ *	Case folding lookup, see casefold_6208.c
+ *
+ *	Same as tolower_5750(), but over CaseFolding.txt. Characters
+ *	that fold into more than one come out as a surrogate, see
+ *	casefold_special() and wcsfold() below.
+ */
+static inline wchar_t casefold_6208(wchar_t ch)
+{
+	return ch + casemap_f_6208[ casemap_f_6208[ch >> 6] + (ch & 0x3f) ];
+}
+
+static inline int casefold_special(wchar_t ch, wchar_t folded)
+{
+	return (folded & 0xf800) == 0xd800 && folded != ch;
+}
+
+/*
+ *	Bulk conversion of wchar_t buffers, see casemap_bulk.c
+ *
+ *	Output is identical to calling tolower_5750() / toupper_5866()
+ *	on every character. 'dst' and 'src' may be the same buffer,
+ *	but they may not partially overlap.
+ */
+void tolower_n(wchar_t * dst, const wchar_t * src, size_t len);
+void toupper_n(wchar_t * dst, const wchar_t * src, size_t len);
+
+void tolower_inplace(wchar_t * str, size_t len);
+void toupper_inplace(wchar_t * str, size_t len);
+
+/*
+ *	Case-insensitive comparison and hashing, see casemap_cmp.c
+ *
+ *	Single pass, no conversion of the whole string up front. Both
+ *	fold with tolower_4422(), so strings that compare equal also
+ *	hash equal. The hash is 32-bit FNV-1a over folded characters.
+ */
+int      wcsicmp_4422(const wchar_t * a, const wchar_t * b);
+int      wcsnicmp_4422(const wchar_t * a, const wchar_t * b, size_t n);
+
+uint32_t wcsihash_4422(const wchar_t * str);
+uint32_t wcsnihash_4422(const wchar_t * str, size_t len);
+
+/*
+ *	UTF-8 case conversion, see casemap_utf8.c
+ *
+ *	Converts 'src_len' bytes of 'src' into 'dst' and returns the
+ *	length of the result. If it's larger than 'dst_max', then the
+ *	output was truncated and the call needs to be repeated with
+ *	a larger buffer. UTF8_CASEMAP_MAX() is always large enough.
+ *	The output is not zero-terminated and it can't be done in place.
+ */
+#define UTF8_CASEMAP_MAX(src_len)  ((src_len) + ((src_len) + 1) / 2)
+
+size_t utf8_tolower(char * dst, size_t dst_max, const char * src, size_t src_len);
+size_t utf8_toupper(char * dst, size_t dst_max, const char * src, size_t src_len);
+
+/*
+ *	Full case folding, see casemap_fold.c
+ *
+ *	Folds per CaseFolding.txt, statuses C and F, in one pass - e.g.
+ *	U+00DF becomes "ss" and U+0149 becomes U+02BC U+006E. Surrogate
+ *	pairs are folded too. Returns the length of the result, same as
+ *	utf8_tolower(), and WCSFOLD_MAX() is always large enough.
+ */
+#define WCSFOLD_MAX(len)  ((len) * 3)
+
+size_t wcsfold(wchar_t * dst, size_t dst_max, const wchar_t * src, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
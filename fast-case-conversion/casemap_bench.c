@@ -0,0 +1,388 @@
+/*
+ *	Fast character case conversion
+ *	https://github.com/apankrat/notes/blob/master/fast-case-conversion
+ *
+ *	Micro-benchmark of all casemap variants plus glibc's towlower(),
+ *	a flat 128KB table and the plain ASCII branch.
+ *
+ *	Build:
+ *
+ *	    gcc -O2 -fshort-wchar -march=native casemap_bench.c casemap_bulk.c casemap_tables.c -o casemap_bench
+ *
+ *	For every input set and every variant this measures
+ *
+ *	    lat   - per-char latency, with each lookup depending on the
+ *	            result of the previous one
+ *	    tput  - throughput of converting a buffer, one independent
+ *	            lookup per character
+ *
+ *	and reports cycles per char and L1D / last-level cache misses
+ *	per 1000 chars. Cycles and misses come from perf counters when
+ *	they are available. If not, cycles are TSC ticks and misses are
+ *	not shown. There is no portable L2 counter, hence the LLC.
+ */
+#include "casemap.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#include <wctype.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define CHARS   (64*1024)
+#define ROUNDS  16
+
+static wchar_t  src[CHARS];
+static wchar_t  dst[CHARS];
+static volatile size_t zero = 0;
+
+/*
+ *	Reference variants
+ */
+static wchar_t flat_l[0x10000];
+static wchar_t flat_u[0x10000];
+
+static inline wchar_t tolower_flat(wchar_t ch) { return flat_l[ch]; }
+static inline wchar_t toupper_flat(wchar_t ch) { return flat_u[ch]; }
+
+static inline wchar_t tolower_glibc(wchar_t ch) { return (wchar_t)towlower(ch); }
+static inline wchar_t toupper_glibc(wchar_t ch) { return (wchar_t)towupper(ch); }
+
+static inline wchar_t tolower_ascii(wchar_t ch) { return ('A' <= ch && ch <= 'Z') ? ch + ('a' - 'A') : ch; }
+static inline wchar_t toupper_ascii(wchar_t ch) { return ('a' <= ch && ch <= 'z') ? ch - ('a' - 'A') : ch; }
+
+/*
+ *	Counters
+ */
+enum { ctr_cycles, ctr_l1d, ctr_llc, ctr_max };
+
+static int ctr_fd[ctr_max] = { -1, -1, -1 };
+
+static void counters_init(void)
+{
+#ifdef __linux__
+	static const struct { uint32_t type; uint64_t config; } ev[ctr_max] =
+	{
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+		{ PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+		{ PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL  | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+	};
+	int i;
+
+	for (i = 0; i < ctr_max; i++)
+	{
+		struct perf_event_attr pe;
+
+		memset(&pe, 0, sizeof pe);
+		pe.size = sizeof pe;
+		pe.type = ev[i].type;
+		pe.config = ev[i].config;
+		pe.disabled = 1;
+		pe.exclude_kernel = 1;
+		pe.exclude_hv = 1;
+
+		ctr_fd[i] = (int)syscall(__NR_perf_event_open, &pe, 0, -1, -1, 0);
+	}
+#endif
+}
+
+static uint64_t tsc(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+struct sample
+{
+	uint64_t  val[ctr_max];
+};
+
+static void counters_start(struct sample * s)
+{
+	int i;
+
+	for (i = 0; i < ctr_max; i++)
+	{
+#ifdef __linux__
+		if (ctr_fd[i] >= 0)
+		{
+			ioctl(ctr_fd[i], PERF_EVENT_IOC_RESET, 0);
+			ioctl(ctr_fd[i], PERF_EVENT_IOC_ENABLE, 0);
+		}
+#endif
+		s->val[i] = 0;
+	}
+
+	if (ctr_fd[ctr_cycles] < 0)
+		s->val[ctr_cycles] = tsc();
+}
+
+static void counters_stop(struct sample * s)
+{
+	int i;
+
+	if (ctr_fd[ctr_cycles] < 0)
+		s->val[ctr_cycles] = tsc() - s->val[ctr_cycles];
+
+	for (i = 0; i < ctr_max; i++)
+	{
+#ifdef __linux__
+		if (ctr_fd[i] >= 0)
+		{
+			uint64_t v = 0;
+
+			ioctl(ctr_fd[i], PERF_EVENT_IOC_DISABLE, 0);
+			if (read(ctr_fd[i], &v, sizeof v) == sizeof v)
+				s->val[i] = v;
+		}
+#endif
+	}
+}
+
+/*
+ *	Benchmarks. The functions are stamped out per variant so that
+ *	lookups get inlined the same way they would in real code.
+ */
+struct variant
+{
+	const char * name;
+	size_t       bytes;
+	uint64_t  (* lat)(void);
+	void      (* tput)(void);
+};
+
+#define BENCH(fn)                                                   \
+	static uint64_t lat_ ## fn(void)                            \
+	{                                                           \
+		size_t  mask = zero;                                \
+		wchar_t ch = 0;                                     \
+		size_t  i;                                          \
+		for (i = 0; i < CHARS; i++)                         \
+			ch = fn(src[i + (ch & mask)]);              \
+		return ch;                                          \
+	}                                                           \
+	static void tput_ ## fn(void)                               \
+	{                                                           \
+		size_t i;                                           \
+		for (i = 0; i < CHARS; i++)                         \
+			dst[i] = fn(src[i]);                        \
+	}
+
+BENCH(tolower_1618)
+BENCH(tolower_2112)
+BENCH(tolower_4422)
+BENCH(tolower_5750)
+BENCH(tolower_8358)
+BENCH(tolower_tiered)
+BENCH(tolower_tiered_bf)
+BENCH(tolower_flat)
+BENCH(tolower_glibc)
+BENCH(tolower_ascii)
+
+BENCH(toupper_1738)
+BENCH(toupper_2258)
+BENCH(toupper_4638)
+BENCH(toupper_5866)
+BENCH(toupper_8358)
+BENCH(toupper_tiered)
+BENCH(toupper_tiered_bf)
+BENCH(toupper_flat)
+BENCH(toupper_glibc)
+BENCH(toupper_ascii)
+
+static void tput_tolower_n(void) { tolower_n(dst, src, CHARS); }
+static void tput_toupper_n(void) { toupper_n(dst, src, CHARS); }
+
+#define VARIANT(fn, bytes)  { #fn, bytes, lat_ ## fn, tput_ ## fn }
+
+static const struct variant variants[] =
+{
+	VARIANT(tolower_1618, 1618),
+	VARIANT(tolower_2112, 2112),
+	VARIANT(tolower_4422, 4422),
+	VARIANT(tolower_5750, 5750),
+	VARIANT(tolower_8358, 8358),
+	VARIANT(tolower_tiered, 4422 + 512),
+	VARIANT(tolower_tiered_bf, 4422 + 512),
+	VARIANT(tolower_flat, sizeof flat_l),
+	VARIANT(tolower_glibc, 0),
+	VARIANT(tolower_ascii, 0),
+	{ "tolower_n", 5750, NULL, tput_tolower_n },
+
+	VARIANT(toupper_1738, 1738),
+	VARIANT(toupper_2258, 2258),
+	VARIANT(toupper_4638, 4638),
+	VARIANT(toupper_5866, 5866),
+	VARIANT(toupper_8358, 8358),
+	VARIANT(toupper_tiered, 4638 + 512),
+	VARIANT(toupper_tiered_bf, 4638 + 512),
+	VARIANT(toupper_flat, sizeof flat_u),
+	VARIANT(toupper_glibc, 0),
+	VARIANT(toupper_ascii, 0),
+	{ "toupper_n", 5866, NULL, tput_toupper_n },
+};
+
+/*
+ *	Inputs
+ */
+static uint32_t rnd_state = 12345;
+
+static uint32_t rnd(void)
+{
+	rnd_state = rnd_state * 1103515245 + 12345;
+	return rnd_state >> 8;
+}
+
+static wchar_t pick(uint32_t lo, uint32_t hi)
+{
+	return (wchar_t)(lo + rnd() % (hi - lo + 1));
+}
+
+static void make_input(const char * what)
+{
+	size_t i;
+
+	for (i = 0; i < CHARS; i++)
+	{
+		uint32_t r = rnd() % 100;
+
+		if (! strcmp(what, "ascii"))
+			src[i] = pick(0x20, 0x7e);
+		else
+		if (! strcmp(what, "latin"))
+			src[i] = (r < 70) ? pick(0x20, 0x7e) : (r < 90) ? pick(0xc0, 0xff) : pick(0x100, 0x17f);
+		else
+		if (! strcmp(what, "cyrillic"))
+			src[i] = (r < 15) ? pick(0x20, 0x40) : pick(0x400, 0x4ff);
+		else
+		if (! strcmp(what, "cjk"))
+			src[i] = (r < 10) ? pick(0x20, 0x40) : pick(0x4e00, 0x9fff);
+		else
+		{
+			do src[i] = pick(0, 0xffff);
+			while (0xd800 <= src[i] && src[i] <= 0xdfff);
+		}
+	}
+}
+
+/*
+ *	Runner
+ */
+static void report(const struct sample * s)
+{
+	double per_char = (double)s->val[ctr_cycles] / CHARS;
+	double per_kchar = 1000.0 / CHARS;
+
+	printf("  %6.2f", per_char);
+
+	if (ctr_fd[ctr_l1d] >= 0)
+		printf("  %6.1f", s->val[ctr_l1d] * per_kchar);
+	else
+		printf("  %6s", "-");
+
+	if (ctr_fd[ctr_llc] >= 0)
+		printf("  %6.1f", s->val[ctr_llc] * per_kchar);
+	else
+		printf("  %6s", "-");
+}
+
+static void keep_min(struct sample * best, const struct sample * s)
+{
+	if (s->val[ctr_cycles] < best->val[ctr_cycles])
+		*best = *s;
+}
+
+static void run(const struct variant * v)
+{
+	struct sample best, s;
+	int i;
+
+	printf("    %-18s %7zu", v->name, v->bytes);
+
+	if (v->lat)
+	{
+		best.val[ctr_cycles] = (uint64_t)-1;
+		for (i = 0; i < ROUNDS; i++)
+		{
+			volatile uint64_t sink;
+			counters_start(&s);
+			sink = v->lat();
+			counters_stop(&s);
+			(void)sink;
+			keep_min(&best, &s);
+		}
+		report(&best);
+	}
+	else
+	{
+		printf("  %6s  %6s  %6s", "-", "-", "-");
+	}
+
+	printf("  |");
+
+	best.val[ctr_cycles] = (uint64_t)-1;
+	for (i = 0; i < ROUNDS; i++)
+	{
+		counters_start(&s);
+		v->tput();
+		counters_stop(&s);
+		keep_min(&best, &s);
+	}
+	report(&best);
+
+	printf("\n");
+}
+
+int main(int argc, char ** argv)
+{
+	static const char * inputs[] = { "ascii", "latin", "cyrillic", "cjk", "bmp" };
+	size_t i, k;
+	unsigned ch;
+
+	setlocale(LC_CTYPE, "C.UTF-8");
+
+	for (ch = 0; ch < 0x10000; ch++)
+	{
+		flat_l[ch] = tolower_5750((wchar_t)ch);
+		flat_u[ch] = toupper_5866((wchar_t)ch);
+	}
+
+	counters_init();
+
+	printf("%s, %s\n\n",
+		(ctr_fd[ctr_cycles] >= 0) ? "cycles from perf counters" : "cycles are TSC ticks",
+		(ctr_fd[ctr_l1d] >= 0) ? "misses per 1000 chars" : "no cache counters");
+
+	for (k = 0; k < sizeof inputs / sizeof inputs[0]; k++)
+	{
+		if (argc > 1 && strcmp(argv[1], inputs[k]))
+			continue;
+
+		make_input(inputs[k]);
+
+		printf("  %s\n\n", inputs[k]);
+		printf("    %-18s %7s  %22s  |  %22s\n", "", "", "--------- lat --------", "-------- tput --------");
+		printf("    %-18s %7s  %6s  %6s  %6s  |  %6s  %6s  %6s\n", "variant", "bytes", "cyc/ch", "L1D", "LLC", "cyc/ch", "L1D", "LLC");
+
+		for (i = 0; i < sizeof variants / sizeof variants[0]; i++)
+			run(&variants[i]);
+
+		printf("\n");
+	}
+
+	return 0;
+}
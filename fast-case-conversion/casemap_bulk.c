@@ -0,0 +1,215 @@
+/*
+ *	Fast character case conversion
+ *	https://github.com/apankrat/notes/blob/master/fast-case-conversion
+ *
+ *	Bulk conversion of wchar_t buffers.
+ *
+ *	Works through the input in vector-sized chunks. Chunks that are
+ *	pure 7-bit ASCII are converted with a couple of compares and an
+ *	add, without touching the table. Other chunks go through the
+ *	Wine-style 5750 / 5866 tables - with two gathers on AVX2 and
+ *	one character at a time otherwise.
+ */
+#include "casemap.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/*
+ *	'table' is casemap_l_5750 or casemap_u_5866, both have the
+ *	same 1024-entry index followed by data.
+ */
+static inline wchar_t casemap_one(const wchar_t * table, wchar_t ch)
+{
+	return ch + table[ table[ch >> 6] + (ch & 0x3f) ];
+}
+
+static inline void casemap_scalar(wchar_t * dst, const wchar_t * src, size_t len,
+                                  const wchar_t * table)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++)
+		dst[i] = casemap_one(table, src[i]);
+}
+
+#if defined(__AVX2__)
+
+/*
+ *	Deltas for a chunk of pure ASCII. [lo, hi] is the range that is
+ *	shifted by 'delta', everything else gets 0. There are only signed
+ *	greater-than compares, so they are passed as lo - 1 and hi + 1.
+ */
+static inline __m256i casemap_ascii16(__m256i v, __m256i vlo, __m256i vhi, __m256i vdelta)
+{
+	__m256i d = _mm256_and_si256(_mm256_cmpgt_epi16(v, vlo), _mm256_cmpgt_epi16(vhi, v));
+	return _mm256_and_si256(d, vdelta);
+}
+
+/*
+ *	Looks up deltas for 8 characters at once. Gathers read 32 bits,
+ *	so the index is read as [i, i+1] (i < 1024, so it stays within
+ *	the table) and the data is read as [i-1, i] (i >= 1024, ditto).
+ */
+static inline __m256i casemap_gather8(const wchar_t * table, __m128i ch8)
+{
+	const __m256i lo16 = _mm256_set1_epi32(0xffff);
+	__m256i ch, off, val;
+
+	ch  = _mm256_cvtepu16_epi32(ch8);
+	off = _mm256_i32gather_epi32((const int *)table, _mm256_srli_epi32(ch, 6), 2);
+	off = _mm256_and_si256(off, lo16);
+	off = _mm256_add_epi32(off, _mm256_and_si256(ch, _mm256_set1_epi32(0x3f)));
+	off = _mm256_sub_epi32(off, _mm256_set1_epi32(1));
+	val = _mm256_i32gather_epi32((const int *)table, off, 2);
+
+	return _mm256_srli_epi32(val, 16);
+}
+
+static void casemap_n(wchar_t * dst, const wchar_t * src, size_t len,
+                      const wchar_t * table, wchar_t lo, wchar_t hi, wchar_t delta)
+{
+	const __m256i non_ascii = _mm256_set1_epi16((short)0xff80);
+	const __m256i vlo = _mm256_set1_epi16((short)(lo - 1));
+	const __m256i vhi = _mm256_set1_epi16((short)(hi + 1));
+	const __m256i vdelta = _mm256_set1_epi16((short)delta);
+
+	for ( ; len >= 16; src += 16, dst += 16, len -= 16)
+	{
+		__m256i v = _mm256_loadu_si256((const __m256i *)src);
+		__m256i d;
+
+		if (_mm256_testz_si256(v, non_ascii))
+		{
+			d = casemap_ascii16(v, vlo, vhi, vdelta);
+		}
+		else
+		{
+			__m256i d0 = casemap_gather8(table, _mm256_castsi256_si128(v));
+			__m256i d1 = casemap_gather8(table, _mm256_extracti128_si256(v, 1));
+
+			/* packus works per 128-bit lane, hence the permute */
+			d = _mm256_permute4x64_epi64(_mm256_packus_epi32(d0, d1), 0xd8);
+		}
+
+		_mm256_storeu_si256((__m256i *)dst, _mm256_add_epi16(v, d));
+	}
+
+	casemap_scalar(dst, src, len, table);
+}
+
+#elif defined(__SSE2__)
+
+/*
+ *	Same as the AVX2 one, [lo, hi] passed as lo - 1 and hi + 1
+ */
+static inline __m128i casemap_ascii8(__m128i v, __m128i vlo, __m128i vhi, __m128i vdelta)
+{
+	__m128i d = _mm_and_si128(_mm_cmpgt_epi16(v, vlo), _mm_cmpgt_epi16(vhi, v));
+	return _mm_and_si128(d, vdelta);
+}
+
+static void casemap_n(wchar_t * dst, const wchar_t * src, size_t len,
+                      const wchar_t * table, wchar_t lo, wchar_t hi, wchar_t delta)
+{
+	const __m128i non_ascii = _mm_set1_epi16((short)0xff80);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i vlo = _mm_set1_epi16((short)(lo - 1));
+	const __m128i vhi = _mm_set1_epi16((short)(hi + 1));
+	const __m128i vdelta = _mm_set1_epi16((short)delta);
+
+	for ( ; len >= 8; src += 8, dst += 8, len -= 8)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i *)src);
+		__m128i d;
+
+		if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, non_ascii), zero)) != 0xffff)
+		{
+			casemap_scalar(dst, src, 8, table);
+			continue;
+		}
+
+		d = casemap_ascii8(v, vlo, vhi, vdelta);
+
+		_mm_storeu_si128((__m128i *)dst, _mm_add_epi16(v, d));
+	}
+
+	casemap_scalar(dst, src, len, table);
+}
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+
+/*
+ *	Same again, but NEON has unsigned >= and <=, so [lo, hi] is
+ *	passed as is
+ */
+static inline uint16x8_t casemap_ascii8(uint16x8_t v, uint16x8_t vlo, uint16x8_t vhi, uint16x8_t vdelta)
+{
+	uint16x8_t d = vandq_u16(vcgeq_u16(v, vlo), vcleq_u16(v, vhi));
+	return vandq_u16(d, vdelta);
+}
+
+static void casemap_n(wchar_t * dst, const wchar_t * src, size_t len,
+                      const wchar_t * table, wchar_t lo, wchar_t hi, wchar_t delta)
+{
+	const uint16x8_t vlo = vdupq_n_u16(lo);
+	const uint16x8_t vhi = vdupq_n_u16(hi);
+	const uint16x8_t vdelta = vdupq_n_u16(delta);
+
+	for ( ; len >= 8; src += 8, dst += 8, len -= 8)
+	{
+		uint16x8_t v = vld1q_u16((const uint16_t *)src);
+		uint16x8_t d;
+
+		if (vmaxvq_u16(v) >= 0x80)
+		{
+			casemap_scalar(dst, src, 8, table);
+			continue;
+		}
+
+		d = casemap_ascii8(v, vlo, vhi, vdelta);
+
+		vst1q_u16((uint16_t *)dst, vaddq_u16(v, d));
+	}
+
+	casemap_scalar(dst, src, len, table);
+}
+
+#else
+
+static void casemap_n(wchar_t * dst, const wchar_t * src, size_t len,
+                      const wchar_t * table, wchar_t lo, wchar_t hi, wchar_t delta)
+{
+	(void)lo; (void)hi; (void)delta;
+	casemap_scalar(dst, src, len, table);
+}
+
+#endif
+
+/*
+ *	API
+ */
+void tolower_n(wchar_t * dst, const wchar_t * src, size_t len)
+{
+	casemap_n(dst, src, len, casemap_l_5750, 'A', 'Z', 'a' - 'A');
+}
+
+void toupper_n(wchar_t * dst, const wchar_t * src, size_t len)
+{
+	casemap_n(dst, src, len, casemap_u_5866, 'a', 'z', (wchar_t)('A' - 'a'));
+}
+
+void tolower_inplace(wchar_t * str, size_t len)
+{
+	tolower_n(str, str, len);
+}
+
+void toupper_inplace(wchar_t * str, size_t len)
+{
+	toupper_n(str, str, len);
+}
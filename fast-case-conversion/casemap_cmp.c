@@ -0,0 +1,209 @@
+/*
+ *	Fast character case conversion
+ *	https://github.com/apankrat/notes/blob/master/fast-case-conversion
+ *
+ *	Case-insensitive comparison and hashing.
+ *
+ *	Both run in a single pass over their inputs without converting
+ *	them first. Characters are folded with tolower_4422() and ASCII
+ *	runs are folded 8 at a time with SSE2 / NEON.
+ *
+ *	Vector loads of zero-terminated strings may read past the
+ *	terminator, but never across a page boundary, so they can't
+ *	fault. This is the same trick libc string functions use. It
+ *	does upset memory checkers though.
+ */
+#include "casemap.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define CASEMAP_VEC 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CASEMAP_VEC 1
+#endif
+
+#define FNV_BASIS  2166136261u
+#define FNV_PRIME  16777619u
+
+#ifdef CASEMAP_VEC
+
+static inline int can_load8(const wchar_t * p)
+{
+	return ((uintptr_t)p & 4095) <= 4096 - 8 * sizeof(wchar_t);
+}
+
+/*
+ *	Loads 8 characters and folds them if they are all ASCII and
+ *	none of them is a zero. Returns 0 otherwise.
+ */
+#if defined(__SSE2__)
+
+typedef __m128i vec_t;
+
+static inline int fold8(const wchar_t * p, vec_t * out)
+{
+	__m128i v = _mm_loadu_si128((const __m128i *)p);
+	__m128i zero = _mm_setzero_si128();
+	__m128i ok, upper;
+
+	ok = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xff80)), zero);
+	ok = _mm_andnot_si128(_mm_cmpeq_epi16(v, zero), ok);
+	if (_mm_movemask_epi8(ok) != 0xffff)
+		return 0;
+
+	upper = _mm_and_si128(_mm_cmpgt_epi16(v, _mm_set1_epi16('A' - 1)), _mm_cmpgt_epi16(_mm_set1_epi16('Z' + 1), v));
+	*out = _mm_add_epi16(v, _mm_and_si128(upper, _mm_set1_epi16('a' - 'A')));
+	return 1;
+}
+
+static inline int equal8(vec_t a, vec_t b)
+{
+	return _mm_movemask_epi8(_mm_cmpeq_epi16(a, b)) == 0xffff;
+}
+
+static inline void store8(wchar_t * p, vec_t v)
+{
+	_mm_storeu_si128((__m128i *)p, v);
+}
+
+#else
+
+typedef uint16x8_t vec_t;
+
+static inline int fold8(const wchar_t * p, vec_t * out)
+{
+	uint16x8_t v = vld1q_u16((const uint16_t *)p);
+	uint16x8_t upper;
+
+	if (vmaxvq_u16(v) >= 0x80 || vminvq_u16(v) == 0)
+		return 0;
+
+	upper = vandq_u16(vcgeq_u16(v, vdupq_n_u16('A')), vcleq_u16(v, vdupq_n_u16('Z')));
+	*out = vaddq_u16(v, vandq_u16(upper, vdupq_n_u16('a' - 'A')));
+	return 1;
+}
+
+static inline int equal8(vec_t a, vec_t b)
+{
+	return vminvq_u16(vceqq_u16(a, b)) == 0xffff;
+}
+
+static inline void store8(wchar_t * p, vec_t v)
+{
+	vst1q_u16((uint16_t *)p, v);
+}
+
+#endif
+
+#endif /* CASEMAP_VEC */
+
+/*
+ *	Comparison
+ */
+int wcsnicmp_4422(const wchar_t * a, const wchar_t * b, size_t n)
+{
+	for (;;)
+	{
+		size_t i, k;
+
+#ifdef CASEMAP_VEC
+		vec_t fa, fb;
+
+		/* all-ASCII, zero-free and equal - skip the lot */
+		if (n >= 8 && can_load8(a) && can_load8(b) &&
+		    fold8(a, &fa) && fold8(b, &fb) && equal8(fa, fb))
+		{
+			a += 8;
+			b += 8;
+			n -= 8;
+			continue;
+		}
+#endif
+		/* otherwise - just the next 8 characters, one at a time */
+		k = (n < 8) ? n : 8;
+
+		for (i = 0; i < k; i++)
+		{
+			wchar_t ca = tolower_4422(a[i]);
+			wchar_t cb = tolower_4422(b[i]);
+
+			if (ca != cb)
+				return (ca < cb) ? -1 : 1;
+
+			if (! ca)
+				return 0;
+		}
+
+		if (k == n)
+			return 0;
+
+		a += k;
+		b += k;
+		n -= k;
+	}
+}
+
+int wcsicmp_4422(const wchar_t * a, const wchar_t * b)
+{
+	return wcsnicmp_4422(a, b, (size_t)-1);
+}
+
+/*
+ *	Hashing, 32-bit FNV-1a over folded 16-bit characters
+ */
+static inline uint32_t fnv_step(uint32_t h, wchar_t ch)
+{
+	return (h ^ ch) * FNV_PRIME;
+}
+
+static uint32_t wcsihash(const wchar_t * str, size_t len, int zstr)
+{
+	uint32_t h = FNV_BASIS;
+
+	for (;;)
+	{
+		size_t i, k;
+
+#ifdef CASEMAP_VEC
+		wchar_t tmp[8];
+		vec_t   v;
+
+		if (len >= 8 && can_load8(str) && fold8(str, &v))
+		{
+			store8(tmp, v);
+			for (i = 0; i < 8; i++)
+				h = fnv_step(h, tmp[i]);
+
+			str += 8;
+			len -= 8;
+			continue;
+		}
+#endif
+		k = (len < 8) ? len : 8;
+
+		for (i = 0; i < k; i++)
+		{
+			if (zstr && ! str[i])
+				return h;
+
+			h = fnv_step(h, tolower_4422(str[i]));
+		}
+
+		if (k == len)
+			return h;
+
+		str += k;
+		len -= k;
+	}
+}
+
+uint32_t wcsihash_4422(const wchar_t * str)
+{
+	return wcsihash(str, (size_t)-1, 1);
+}
+
+uint32_t wcsnihash_4422(const wchar_t * str, size_t len)
+{
+	return wcsihash(str, len, 0);
+}
@@ -0,0 +1,69 @@
+/*
+ *	Fast character case conversion
+ *	https://github.com/apankrat/notes/blob/master/fast-case-conversion
+ *
+ *	Full case folding in one pass.
+ *
+ *	Most characters fold into one and for them this is a single
+ *	lookup and an add, same as tolower_5750(). The hundred or so
+ *	that fold into more than one (U+00DF, U+0149, U+0390, the
+ *	ligatures, etc.) have a delta that maps them into the surrogate
+ *	range, at 0xD800 + their offset in casemap_f_6208_exp[]. That
+ *	is the count of characters followed by the characters.
+ *
+ *	Surrogates can't be a result of a fold, so the only thing to
+ *	tell apart is a surrogate that folds into itself. These are
+ *	then decoded and folded with tolower_astral(), which is the
+ *	same thing for planes 1 - 16 as of Unicode 13.
+ */
+#include "casemap.h"
+
+static inline void put(wchar_t * dst, size_t dst_max, size_t * out, wchar_t ch)
+{
+	if (*out < dst_max)
+		dst[*out] = ch;
+	(*out)++;
+}
+
+size_t wcsfold(wchar_t * dst, size_t dst_max, const wchar_t * src, size_t len)
+{
+	size_t out = 0;
+	size_t i, k;
+
+	for (i = 0; i < len; i++)
+	{
+		wchar_t ch = src[i];
+		wchar_t folded = casefold_6208(ch);
+		const wchar_t * exp;
+
+		if ((folded & 0xf800) != 0xd800)
+		{
+			put(dst, dst_max, &out, folded);
+			continue;
+		}
+
+		if (folded != ch)
+		{
+			exp = casemap_f_6208_exp + (folded - 0xd800);
+			for (k = 1; k <= exp[0]; k++)
+				put(dst, dst_max, &out, exp[k]);
+			continue;
+		}
+
+		/* surrogate pair or a lone surrogate */
+		if (ch < 0xdc00 && i+1 < len && (src[i+1] & 0xfc00) == 0xdc00)
+		{
+			char32_t cp = 0x10000 + (((char32_t)ch - 0xd800) << 10) + (src[i+1] - 0xdc00);
+
+			cp = tolower_astral(cp) - 0x10000;
+			put(dst, dst_max, &out, (wchar_t)(0xd800 + (cp >> 10)));
+			put(dst, dst_max, &out, (wchar_t)(0xdc00 + (cp & 0x3ff)));
+			i++;
+			continue;
+		}
+
+		put(dst, dst_max, &out, ch);
+	}
+
+	return out;
+}
@@ -0,0 +1,1530 @@
+/*
+ *	Fast character case conversion
+ *	https://github.com/apankrat/notes/blob/master/fast-case-conversion
+ *
+ *	Table generator. Reads a case mapping, squishes it and writes
+ *	out the tables in the same format as tolower_*.c / toupper_*.c
+ *
+ *	Build:
+ *
+ *	    g++ -O2 -std=c++17 -pthread casemap_gen.cpp -o casemap_gen
+ *
+ *	Usage:
+ *
+ *	    casemap_gen [options] <UnicodeData.txt | mapping.txt>
+ *
+ *	    -l         lower case mapping (default)
+ *	    -u         upper case mapping
+ *	    -t <type>  table layout -
+ *	                 single     Wine-style merged array  (tolower_5750.c)
+ *	                 single-ex  index, offsets and data  (tolower_4422.c)
+ *	                 double     three arrays, merged     (tolower_2112.c)
+ *	                 double-ex  five arrays              (tolower_1618.c)
+ *	                 latin1     U+0000 - U+00FF as is    (tolower_latin1.c)
+ *	                 pair       lower and upper case together,
+ *	                            single-ex style          (casepair_*.c)
+ *	    -b <bits>  data block size, log2
+ *	    -s <bits>  index sequence size, log2, double layouts only
+ *	    -o <file>  output file, default is to{lower,upper}_<bytes>.c
+ *	    -j <num>   number of threads, default is all cores
+ *	    -S         don't generate anything, just sweep through all
+ *	               block sizes and print the summary
+ *	    -A         generate tables for planes 1 - 16 instead of the
+ *	               BMP, see below
+ *	    -c <bits>  size of top-level index chunks, log2, -A only
+ *	    -f         full case folding, from CaseFolding.txt or a
+ *	               mapping like casefold-table.txt, see below
+ *
+ *	The mapping file is in the format of tolower-table.txt, one
+ *	"from  ->  to" pair of hex values per line. It can be either a
+ *	lower or an upper case one, and it's reversed for the other.
+ *
+ *	By default only the BMP part of the mapping is used. With -A
+ *	it's the other way around - the BMP is skipped and the rest
+ *	is squished into the five arrays of the double-ex layout, plus
+ *	one more index level in front of them to cover the 21 bits.
+ *	Block sizes that aren't given with -b, -s and -c are picked to
+ *	give the smallest tables.
+ *
+ *	With -t pair both cases come from the same input - fields 12
+ *	and 13 of UnicodeData.txt, or the mapping and the mapping in
+ *	reverse. The block size is picked to give the smallest tables
+ *	unless it's given with -b.
+ *
+ *	With -f the mapping may have more than one character on the
+ *	right side. Such characters get a delta that lands them in the
+ *	surrogate range, at 0xD800 + their offset in a separate table
+ *	of expansions. Each expansion is its length followed by the
+ *	characters. Output is casefold_<bytes>.c, with the expansions
+ *	not counted in the <bytes>.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ *	Misc
+ */
+typedef std::vector<uint16_t>  array_t;
+
+static void die(const char * msg, const char * arg = "")
+{
+	fprintf(stderr, "casemap_gen: %s%s\n", msg, arg);
+	exit(1);
+}
+
+template <typename F>
+static void parallel_for(size_t n, unsigned threads, F f)
+{
+	std::atomic<size_t>        next(0);
+	std::vector<std::thread>  pool;
+
+	auto worker = [&]()
+	{
+		for (size_t i; (i = next++) < n; )
+			f(i);
+	};
+
+	threads = std::max(1u, std::min<unsigned>(threads, n));
+	for (unsigned i = 1; i < threads; i++)
+		pool.emplace_back(worker);
+
+	worker();
+
+	for (auto & t : pool)
+		t.join();
+}
+
+/*
+ *	Input
+ */
+/*
+ *	Mapping files can go either way, e.g. tolower-table.txt and
+ *	toupper-astral-table.txt. Upper case letters nearly always come
+ *	first in Unicode, so the file is taken to be a lower case one
+ *	when most of its pairs map up the code points, and it's read in
+ *	reverse if that's not the case that was asked for.
+ */
+static std::vector<uint32_t> load_mapping(const char * file, bool upper)
+{
+	std::vector<uint32_t> map(0x110000);
+	std::vector<std::pair<uint32_t, uint32_t>> pairs;
+	size_t ups = 0;
+	char line[1024];
+	FILE * fh;
+
+	for (uint32_t i = 0; i < map.size(); i++)
+		map[i] = i;
+
+	fh = fopen(file, "r");
+	if (! fh)
+		die("failed to open ", file);
+
+	while (fgets(line, sizeof line, fh))
+	{
+		uint32_t from, to;
+
+		if (strchr(line, ';'))
+		{
+			/* UnicodeData.txt - field 12 is upper case, 13 is lower */
+			const char * p = line;
+			int field = upper ? 12 : 13;
+
+			from = strtoul(p, NULL, 16);
+			while (field-- && (p = strchr(p, ';')))
+				p++;
+
+			if (! p || *p == ';' || *p == '\n' || *p == '\r')
+				continue;
+
+			to = strtoul(p, NULL, 16);
+		}
+		else
+		{
+			if (sscanf(line, "%x -> %x", &from, &to) != 2)
+				continue;
+
+			pairs.push_back({ from, to });
+			ups += (from < to);
+			continue;
+		}
+
+		if (from < map.size() && to < map.size())
+			map[from] = to;
+	}
+
+	fclose(fh);
+
+	for (auto & p : pairs)
+	{
+		bool lower_file = (2*ups >= pairs.size());
+		uint32_t from = p.first, to = p.second;
+
+		if (lower_file == upper)
+			std::swap(from, to);
+
+		if (from < map.size() && to < map.size())
+			map[from] = to;
+	}
+
+	return map;
+}
+
+/*
+ *	CaseFolding.txt - statuses C and F, which is the full folding -
+ *	or a "from  ->  to to ..." mapping. Characters that fold into
+ *	one go into 'map', the rest into 'multi'.
+ */
+typedef std::vector<std::pair<uint32_t, std::vector<uint32_t>>>  multi_t;
+
+static std::vector<uint32_t> load_folding(const char * file, multi_t & multi)
+{
+	std::vector<uint32_t> map(0x110000);
+	char line[1024];
+	FILE * fh;
+
+	for (uint32_t i = 0; i < map.size(); i++)
+		map[i] = i;
+
+	fh = fopen(file, "r");
+	if (! fh)
+		die("failed to open ", file);
+
+	while (fgets(line, sizeof line, fh))
+	{
+		std::vector<uint32_t> to;
+		uint32_t from;
+		char * p = line;
+		char * end;
+
+		if (*p == '#')
+			continue;
+
+		from = strtoul(p, &end, 16);
+		if (end == p || from >= map.size())
+			continue;
+
+		if (strchr(line, ';'))
+		{
+			p = strchr(p, ';') + 1;
+			while (*p == ' ')
+				p++;
+
+			if ((*p != 'C' && *p != 'F') || ! (p = strchr(p, ';')))
+				continue;
+			p++;
+		}
+		else
+		{
+			if (! (p = strstr(p, "->")))
+				continue;
+			p += 2;
+		}
+
+		/* targets, up to the next ';' or the end of line */
+		for (;;)
+		{
+			uint32_t val = strtoul(p, &end, 16);
+			if (end == p)
+				break;
+			to.push_back(val);
+			p = end;
+		}
+
+		if (to.size() == 1)
+			map[from] = to[0];
+		else
+		if (to.size() > 1)
+			multi.push_back(std::make_pair(from, to));
+	}
+
+	fclose(fh);
+	return map;
+}
+
+/*
+ *	Blocks
+ */
+struct blocks
+{
+	std::vector<array_t>  unique;  // unique blocks
+	std::vector<int>      id;      // block -> id of its unique version
+};
+
+static blocks split(const array_t & arr, size_t len)
+{
+	blocks r;
+
+	for (size_t i = 0; i < arr.size(); i += len)
+	{
+		array_t blk(arr.begin() + i, arr.begin() + i + len);
+		size_t  k;
+
+		for (k = 0; k < r.unique.size(); k++)
+			if (r.unique[k] == blk)
+				break;
+
+		if (k == r.unique.size())
+			r.unique.push_back(blk);
+
+		r.id.push_back((int)k);
+	}
+
+	return r;
+}
+
+/*
+ *	Squish
+ *
+ *	The overlap of 'a' and 'b' is the longest suffix of 'a' that
+ *	is also a prefix of 'b'. The best squish is then the heaviest
+ *	Hamiltonian path through the overlap matrix.
+ */
+static int overlap(const array_t & a, const array_t & b)
+{
+	/* prefix function of b + a, without letting it go past b */
+	size_t n = b.size();
+	std::vector<uint32_t> s(b.begin(), b.end());
+	std::vector<size_t>   pi(2*n + 1, 0);
+
+	s.push_back(0xffffffff);
+	s.insert(s.end(), a.begin(), a.end());
+
+	for (size_t i = 1; i < s.size(); i++)
+	{
+		size_t k = pi[i-1];
+		while (k && s[i] != s[k])
+			k = pi[k-1];
+		pi[i] = k + (s[i] == s[k]);
+	}
+
+	return (int)std::min(pi.back(), n - 1);
+}
+
+struct squish_ctx
+{
+	size_t            n;
+	std::vector<int>  w;   // n x n overlaps
+
+	int weight(int i, int j) const { return (i < 0 || j < 0) ? 0 : w[i*n + j]; }
+
+	int score(const std::vector<int> & seq) const
+	{
+		int r = 0;
+		for (size_t i = 1; i < seq.size(); i++)
+			r += weight(seq[i-1], seq[i]);
+		return r;
+	}
+};
+
+/*
+ *	Exact search, Held-Karp style. Fine for up to 18 or so blocks.
+ */
+static const size_t exact_max = 18;
+
+static std::vector<int> squish_exact(const squish_ctx & ctx)
+{
+	size_t n = ctx.n;
+	size_t full = (size_t)1 << n;
+	std::vector<int>     dp(full * n, -1);
+	std::vector<int8_t>  from(full * n, -1);
+	std::vector<int>     seq;
+	size_t mask;
+	int last;
+
+	for (size_t i = 0; i < n; i++)
+		dp[((size_t)1 << i)*n + i] = 0;
+
+	for (mask = 1; mask < full; mask++)
+		for (size_t i = 0; i < n; i++)
+		{
+			int cur = dp[mask*n + i];
+			if (cur < 0)
+				continue;
+
+			for (size_t j = 0; j < n; j++)
+			{
+				size_t next = mask | ((size_t)1 << j);
+				int    val  = cur + ctx.weight(i, j);
+
+				if (next == mask || dp[next*n + j] >= val)
+					continue;
+
+				dp[next*n + j] = val;
+				from[next*n + j] = (int8_t)i;
+			}
+		}
+
+	mask = full - 1;
+	last = 0;
+	for (size_t i = 1; i < n; i++)
+		if (dp[mask*n + i] > dp[mask*n + last])
+			last = (int)i;
+
+	while (last >= 0)
+	{
+		int prev = from[mask*n + last];
+		seq.push_back(last);
+		mask &= ~((size_t)1 << last);
+		last = prev;
+	}
+
+	std::reverse(seq.begin(), seq.end());
+	return seq;
+}
+
+/*
+ *	Heuristic search
+ *
+ *	1. Assemble a sequence out of one or more parts, repeatedly
+ *	   picking the heaviest link that either starts a new part,
+ *	   extends an existing one or merges two parts together.
+ *
+ *	2. Refine it by splitting it in two and swapping the halves,
+ *	   by moving single blocks around and by swapping pairs of
+ *	   blocks, for as long as any of that helps.
+ *
+ *	How ties are resolved in (1) matters, so this is run with a
+ *	number of different strategies and the best result is kept.
+ */
+enum link_kind { link_merge, link_append, link_prepend, link_new };
+
+struct strategy
+{
+	bool      multi;     // allow more than one part
+	int       rank[4];   // tie-breaking preference of link_kinds
+	unsigned  seed;      // 0 - no random tie-breaking
+};
+
+static std::vector<int> assemble(const squish_ctx & ctx, const strategy & st)
+{
+	int n = (int)ctx.n;
+	std::vector<int> next(n, -1), prev(n, -1), part(n, -1);
+	std::mt19937 rng(st.seed);
+	std::vector<unsigned> noise(n*n, 0);
+	std::vector<int> seq;
+	int parts = 0;
+
+	if (st.seed)
+		for (auto & x : noise)
+			x = rng();
+
+	for (int links = 0; links < n-1; links++)
+	{
+		int bi = -1, bj = -1, bw = -1, br = 0;
+		unsigned bn = 0;
+
+		for (int i = 0; i < n; i++)
+		{
+			if (next[i] >= 0)
+				continue;
+
+			for (int j = 0; j < n; j++)
+			{
+				link_kind kind;
+				int w, r;
+
+				if (i == j || prev[j] >= 0)
+					continue;
+
+				if (part[i] >= 0 && part[i] == part[j])
+					continue;
+
+				if (part[i] >= 0)
+					kind = (part[j] >= 0) ? link_merge : link_append;
+				else
+					kind = (part[j] >= 0) ? link_prepend : link_new;
+
+				if (! st.multi && parts && (kind == link_new || kind == link_merge))
+					continue;
+
+				w = ctx.weight(i, j);
+				r = st.rank[kind];
+
+				if (w < bw)
+					continue;
+
+				if (w == bw && (r > br || (r == br && noise[i*n+j] <= bn)))
+					continue;
+
+				bi = i; bj = j; bw = w; br = r; bn = noise[i*n+j];
+			}
+		}
+
+		next[bi] = bj;
+		prev[bj] = bi;
+
+		if (part[bi] < 0 && part[bj] < 0)
+		{
+			part[bi] = part[bj] = parts++;
+		}
+		else
+		if (part[bi] < 0)
+		{
+			part[bi] = part[bj];
+		}
+		else
+		if (part[bj] < 0)
+		{
+			part[bj] = part[bi];
+		}
+		else
+		{
+			int old = part[bj];
+			for (auto & p : part)
+				if (p == old)
+					p = part[bi];
+		}
+	}
+
+	for (int i = 0; i < n; i++)
+		if (prev[i] < 0)
+			for (int j = i; j >= 0; j = next[j])
+				seq.push_back(j);
+
+	return seq;
+}
+
+static bool refine_split(const squish_ctx & ctx, std::vector<int> & seq)
+{
+	size_t n = seq.size();
+
+	for (size_t k = 1; k < n; k++)
+		if (ctx.weight(seq[n-1], seq[0]) > ctx.weight(seq[k-1], seq[k]))
+		{
+			std::rotate(seq.begin(), seq.begin() + k, seq.end());
+			return true;
+		}
+
+	return false;
+}
+
+static bool refine_move(const squish_ctx & ctx, std::vector<int> & seq)
+{
+	int n = (int)seq.size();
+
+	for (int p = 0; p < n; p++)
+	{
+		int x = seq[p];
+		int a = (p > 0)   ? seq[p-1] : -1;
+		int b = (p < n-1) ? seq[p+1] : -1;
+		int gain_del = ctx.weight(a, b) - ctx.weight(a, x) - ctx.weight(x, b);
+		std::vector<int> rest(seq);
+
+		rest.erase(rest.begin() + p);
+
+		for (int q = 0; q < n; q++)
+		{
+			int c = (q > 0)   ? rest[q-1] : -1;
+			int d = (q < n-1) ? rest[q]   : -1;
+			int gain_ins = ctx.weight(c, x) + ctx.weight(x, d) - ctx.weight(c, d);
+
+			if (gain_del + gain_ins <= 0)
+				continue;
+
+			rest.insert(rest.begin() + q, x);
+			seq.swap(rest);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool refine_swap(const squish_ctx & ctx, std::vector<int> & seq)
+{
+	int before = ctx.score(seq);
+
+	for (size_t p = 0; p < seq.size(); p++)
+		for (size_t q = p+1; q < seq.size(); q++)
+		{
+			std::swap(seq[p], seq[q]);
+			if (ctx.score(seq) > before)
+				return true;
+			std::swap(seq[p], seq[q]);
+		}
+
+	return false;
+}
+
+static std::vector<int> squish_heuristic(const squish_ctx & ctx, unsigned threads)
+{
+	static const int ranks[][4] =
+	{
+		/* merge, append, prepend, new */
+		{ 0, 1, 1, 2 },
+		{ 1, 0, 2, 3 },
+		{ 1, 2, 0, 3 },
+		{ 2, 0, 0, 1 },
+	};
+
+	std::vector<strategy>          plan;
+	std::vector<std::vector<int>>  seqs;
+	size_t best = 0;
+
+	for (unsigned seed = 0; seed < 8; seed++)
+		for (auto & r : ranks)
+			for (bool multi : { true, false })
+			{
+				strategy st = { multi, { r[0], r[1], r[2], r[3] }, seed };
+				plan.push_back(st);
+			}
+
+	seqs.resize(plan.size());
+
+	parallel_for(plan.size(), threads, [&](size_t i)
+	{
+		std::vector<int> seq = assemble(ctx, plan[i]);
+
+		while (refine_split(ctx, seq) || refine_move(ctx, seq) || refine_swap(ctx, seq))
+			;
+
+		seqs[i].swap(seq);
+	});
+
+	for (size_t i = 1; i < seqs.size(); i++)
+		if (ctx.score(seqs[i]) > ctx.score(seqs[best]))
+			best = i;
+
+	return seqs[best];
+}
+
+/*
+ *	Squishes 'arr' split in blocks of 'len' items. Returns the
+ *	squished data and block offsets in it, by block id.
+ */
+struct squished
+{
+	blocks               blk;
+	array_t              data;
+	std::vector<size_t>  offset;   // by unique block id
+};
+
+static squished squish(const array_t & arr, size_t len, unsigned threads)
+{
+	squished    r;
+	squish_ctx  ctx;
+	std::vector<int> seq;
+	size_t pos = 0;
+
+	r.blk = split(arr, len);
+
+	ctx.n = r.blk.unique.size();
+	ctx.w.resize(ctx.n * ctx.n);
+
+	for (size_t i = 0; i < ctx.n; i++)
+		for (size_t j = 0; j < ctx.n; j++)
+			if (i != j)
+				ctx.w[i*ctx.n + j] = overlap(r.blk.unique[i], r.blk.unique[j]);
+
+	if (ctx.n == 1)
+		seq.push_back(0);
+	else
+	if (ctx.n <= exact_max)
+		seq = squish_exact(ctx);
+	else
+		seq = squish_heuristic(ctx, threads);
+
+	r.offset.resize(ctx.n);
+
+	for (size_t k = 0; k < seq.size(); k++)
+	{
+		const array_t & b = r.blk.unique[seq[k]];
+
+		if (k)
+			pos += len - ctx.weight(seq[k-1], seq[k]);
+
+		r.offset[seq[k]] = pos;
+		r.data.resize(pos + len);
+		std::copy(b.begin(), b.end(), r.data.begin() + pos);
+	}
+
+	return r;
+}
+
+/*
+ *	Layouts
+ */
+enum layout { layout_single, layout_single_ex, layout_double, layout_double_ex, layout_astral, layout_latin1, layout_pair };
+
+struct tables
+{
+	layout   type;
+	int      b, s, c;   // block, sequence and chunk size, log2
+
+	/* astral */
+	array_t  idx0;      // uint8
+	array_t  off0;
+
+	/* single-ex, double-ex, astral and pair */
+	array_t  idx1;      // uint8
+	array_t  off1;
+	array_t  idx2;      // uint8
+	array_t  off2;
+
+	/* single and double - index and sequences are merged into 'dat' */
+	size_t   jndex;     // size of the top-level index
+	size_t   seqs;      // size of the index sequences
+
+	array_t  dat;
+
+	size_t bytes() const
+	{
+		switch (type)
+		{
+		case layout_single:     return dat.size() * 2;
+		case layout_single_ex:  return idx1.size() + (off1.size() + dat.size()) * 2;
+		case layout_double:     return dat.size() * 2;
+		case layout_double_ex:  return idx1.size() + idx2.size() + (off1.size() + off2.size() + dat.size()) * 2;
+		case layout_astral:     return idx0.size() + idx1.size() + idx2.size() +
+		                               (off0.size() + off1.size() + off2.size() + dat.size()) * 2;
+		case layout_latin1:     return dat.size() * 2;
+		case layout_pair:       return idx1.size() + (off1.size() + dat.size()) * 2;
+		}
+		return 0;
+	}
+};
+
+static void check_u16(size_t val)
+{
+	if (val > 0xffff)
+		die("offset doesn't fit into 16 bits, try a different block size");
+}
+
+static void check_u8(size_t count)
+{
+	if (count > 0x100)
+		die("more than 256 unique blocks, try a different block size");
+}
+
+/*
+ *	Not a squish - just the first 256 characters as they map. This
+ *	is the direct table in front of the squished ones.
+ */
+static tables build_latin1(const array_t & delta)
+{
+	tables t;
+
+	t.type = layout_latin1;
+	t.b = t.s = t.c = 0;
+	t.jndex = t.seqs = 0;
+
+	for (uint32_t ch = 0; ch < 0x100; ch++)
+		t.dat.push_back((uint16_t)(ch + delta[ch]));
+
+	return t;
+}
+
+/*
+ *	Lower and upper case deltas side by side, squished as one. Each
+ *	distinct pair of deltas is mapped to a symbol, the symbols are
+ *	squished as usual and then expanded back into pairs. Offsets
+ *	are pre-multiplied by 2.
+ */
+static tables build_pair(const array_t & lower, const array_t & upper, int b, unsigned threads)
+{
+	std::map<uint32_t, uint16_t> ids;
+	std::vector<uint32_t> pairs;
+	array_t  sym(lower.size());
+	squished sq;
+	tables   t;
+
+	for (size_t ch = 0; ch < lower.size(); ch++)
+	{
+		uint32_t val = lower[ch] | ((uint32_t)upper[ch] << 16);
+		auto it = ids.find(val);
+
+		if (it == ids.end())
+		{
+			it = ids.insert(std::make_pair(val, (uint16_t)pairs.size())).first;
+			pairs.push_back(val);
+		}
+
+		sym[ch] = it->second;
+	}
+
+	sq = squish(sym, (size_t)1 << b, threads);
+
+	t.type = layout_pair;
+	t.b = b;
+	t.s = t.c = 0;
+	t.jndex = t.seqs = 0;
+
+	check_u8(sq.blk.unique.size());
+
+	for (int id : sq.blk.id)
+		t.idx1.push_back((uint16_t)id);
+
+	for (size_t off : sq.offset)
+	{
+		check_u16(off * 2);
+		t.off1.push_back((uint16_t)(off * 2));
+	}
+
+	for (uint16_t v : sq.data)
+	{
+		t.dat.push_back((uint16_t)pairs[v]);
+		t.dat.push_back((uint16_t)(pairs[v] >> 16));
+	}
+
+	return t;
+}
+
+static tables build_single(const array_t & delta, int b, unsigned threads, bool ex)
+{
+	squished sq = squish(delta, (size_t)1 << b, threads);
+	tables   t;
+
+	t.type = ex ? layout_single_ex : layout_single;
+	t.b = b;
+	t.s = 0;
+	t.c = 0;
+	t.jndex = sq.blk.id.size();
+	t.seqs = 0;
+
+	if (ex)
+	{
+		check_u8(sq.blk.unique.size());
+
+		for (int id : sq.blk.id)
+			t.idx1.push_back((uint16_t)id);
+
+		for (size_t off : sq.offset)
+			t.off1.push_back((uint16_t)off);
+
+		t.dat = sq.data;
+	}
+	else
+	{
+		for (int id : sq.blk.id)
+		{
+			check_u16(t.jndex + sq.offset[id]);
+			t.dat.push_back((uint16_t)(t.jndex + sq.offset[id]));
+		}
+
+		t.dat.insert(t.dat.end(), sq.data.begin(), sq.data.end());
+	}
+
+	return t;
+}
+
+static tables build_double(const squished & data, int b, int s, unsigned threads, bool ex)
+{
+	array_t   index(data.blk.id.begin(), data.blk.id.end());
+	squished  sq = squish(index, (size_t)1 << s, threads);
+	tables    t;
+
+	t.type = ex ? layout_double_ex : layout_double;
+	t.b = b;
+	t.s = s;
+	t.c = 0;
+	t.jndex = sq.blk.id.size();
+	t.seqs = sq.data.size();
+
+	if (ex)
+	{
+		check_u8(sq.blk.unique.size());
+		check_u8(data.blk.unique.size());
+
+		for (int id : sq.blk.id)
+			t.idx1.push_back((uint16_t)id);
+
+		for (size_t off : sq.offset)
+			t.off1.push_back((uint16_t)off);
+
+		t.idx2 = sq.data;
+
+		for (size_t off : data.offset)
+			t.off2.push_back((uint16_t)off);
+
+		t.dat = data.data;
+	}
+	else
+	{
+		size_t data_base = t.jndex + t.seqs;
+
+		for (int id : sq.blk.id)
+			t.dat.push_back((uint16_t)(t.jndex + sq.offset[id]));
+
+		for (uint16_t id : sq.data)
+		{
+			check_u16(data_base + data.offset[id]);
+			t.dat.push_back((uint16_t)(data_base + data.offset[id]));
+		}
+
+		t.dat.insert(t.dat.end(), data.data.begin(), data.data.end());
+	}
+
+	return t;
+}
+
+/*
+ *	Astral - double-ex for the index of index sequences. Returns
+ *	false if the result doesn't fit into uint8 / uint16 arrays.
+ */
+static bool fits(const squished & sq)
+{
+	return sq.blk.unique.size() <= 0x100 && sq.data.size() <= 0x10000;
+}
+
+static bool build_astral(const squished & data, const squished & seqs, int b, int s, int c, unsigned threads, tables & t)
+{
+	array_t   index(seqs.blk.id.begin(), seqs.blk.id.end());
+	squished  sq = squish(index, (size_t)1 << c, threads);
+
+	if (! fits(data) || ! fits(seqs) || ! fits(sq))
+		return false;
+
+	t.type = layout_astral;
+	t.b = b;
+	t.s = s;
+	t.c = c;
+	t.jndex = sq.blk.id.size();
+	t.seqs = 0;
+
+	t.idx0.assign(sq.blk.id.begin(), sq.blk.id.end());
+	t.off0.assign(sq.offset.begin(), sq.offset.end());
+	t.idx1 = sq.data;
+	t.off1.assign(seqs.offset.begin(), seqs.offset.end());
+	t.idx2 = seqs.data;
+	t.off2.assign(data.offset.begin(), data.offset.end());
+	t.dat = data.data;
+
+	return true;
+}
+
+static tables search_astral(const array_t & delta, int b, int s, int c, unsigned threads)
+{
+	struct job { int b, s, c; tables t; bool ok; };
+
+	std::vector<squished>  data(16), seqs(16 * 16);
+	std::vector<job>       jobs;
+	std::vector<std::pair<int, int>> bs;
+	size_t best = 0;
+
+	for (int i = 2; i <= 6; i++)
+		for (int j = 2; j <= 6; j++)
+			for (int k = 2; i + j + k <= 16; k++)
+			{
+				if ((b > 0 && b != i) || (s > 0 && s != j) || (c > 0 && c != k))
+					continue;
+
+				job jb = { i, j, k, tables(), false };
+				jobs.push_back(jb);
+
+				if (bs.empty() || bs.back() != std::make_pair(i, j))
+					bs.push_back(std::make_pair(i, j));
+			}
+
+	if (jobs.empty())
+		die("block sizes are out of range");
+
+	parallel_for(7, threads, [&](size_t i)
+	{
+		for (auto & x : bs)
+			if (x.first == (int)i)
+			{
+				data[i] = squish(delta, (size_t)1 << i, 1);
+				break;
+			}
+	});
+
+	parallel_for(bs.size(), threads, [&](size_t i)
+	{
+		int bi = bs[i].first, si = bs[i].second;
+		array_t index(data[bi].blk.id.begin(), data[bi].blk.id.end());
+		seqs[bi*16 + si] = squish(index, (size_t)1 << si, 1);
+	});
+
+	parallel_for(jobs.size(), threads, [&](size_t i)
+	{
+		job & jb = jobs[i];
+		jb.ok = build_astral(data[jb.b], seqs[jb.b*16 + jb.s], jb.b, jb.s, jb.c, 1, jb.t);
+	});
+
+	for (size_t i = 0; i < jobs.size(); i++)
+		if (jobs[i].ok && (! jobs[best].ok || jobs[i].t.bytes() < jobs[best].t.bytes()))
+			best = i;
+
+	if (! jobs[best].ok)
+		die("no block sizes fit, try different ones");
+
+	return jobs[best].t;
+}
+
+/*
+ *	Lookups over generated tables, same as the ones in the comment
+ *	block of the generated files. Used for self-checking.
+ */
+static uint16_t lookup(const tables & t, uint32_t ch, bool upper = false)
+{
+	uint32_t bmask = (1u << t.b) - 1;
+	uint32_t smask = (1u << t.s) - 1;
+	uint32_t cmask = (1u << t.c) - 1;
+	size_t   block, seq;
+
+	switch (t.type)
+	{
+	case layout_latin1:
+		return (ch < 0x100) ? t.dat[ch] : (uint16_t)ch;
+
+	case layout_pair:
+		return (uint16_t)(ch + t.dat[ t.off1[ t.idx1[ch >> t.b] ] + ((ch & bmask) << 1) + upper ]);
+
+	case layout_single:
+		return (uint16_t)(ch + t.dat[ t.dat[ch >> t.b] + (ch & bmask) ]);
+
+	case layout_single_ex:
+		return (uint16_t)(ch + t.dat[ t.off1[ t.idx1[ch >> t.b] ] + (ch & bmask) ]);
+
+	case layout_double:
+		return (uint16_t)(ch + t.dat[ t.dat[ t.dat[ch >> (t.b + t.s)] + ((ch >> t.b) & smask) ] + (ch & bmask) ]);
+
+	case layout_double_ex:
+		block = t.idx2[ t.off1[ t.idx1[ch >> (t.b + t.s)] ] + ((ch >> t.b) & smask) ];
+		return (uint16_t)(ch + t.dat[ t.off2[ block ] + (ch & bmask) ]);
+
+	case layout_astral:
+		seq   = t.idx1[ t.off0[ t.idx0[ch >> (t.b + t.s + t.c)] ] + ((ch >> (t.b + t.s)) & cmask) ];
+		block = t.idx2[ t.off1[ seq ] + ((ch >> t.b) & smask) ];
+		return (uint16_t)(ch + (int16_t)t.dat[ t.off2[ block ] + (ch & bmask) ]);
+	}
+
+	return 0;
+}
+
+/*
+ *	Output
+ */
+static void emit_values(FILE * fh, const array_t & arr, size_t from, size_t to, bool byte)
+{
+	size_t per_row = byte ? 16 : 8;
+
+	for (size_t i = from; i < to; i++)
+	{
+		if ((i - from) % per_row == 0)
+			fprintf(fh, "\t");
+
+		fprintf(fh, byte ? "0x%02x, " : "0x%04x, ", arr[i]);
+
+		if ((i - from) % per_row == per_row-1 || i == to-1)
+			fprintf(fh, "\n");
+	}
+}
+
+static void emit_array(FILE * fh, const char * type, const std::string & name, const array_t & arr)
+{
+	bool byte = ! strcmp(type, "uint8_t");
+
+	fprintf(fh, "const %s %s[%zu] = \n{\n", type, name.c_str(), arr.size());
+	emit_values(fh, arr, 0, arr.size(), byte);
+	fprintf(fh, "};\n");
+}
+
+static void emit(FILE * fh, const tables & t, const std::string & fn, const std::string & name, const array_t & exp)
+{
+	const char * nm  = name.c_str();
+	unsigned bmask = (1u << t.b) - 1;
+	unsigned smask = (1u << t.s) - 1;
+	unsigned cmask = (1u << t.c) - 1;
+
+	if (t.type == layout_astral)
+		fprintf(fh, "/*\ninline char32_t %s(char32_t ch)\n{\n", fn.c_str());
+	else
+	if (t.type == layout_pair)
+		fprintf(fh, "/*\ninline void %s(wchar_t ch, wchar_t * lower, wchar_t * upper)\n{\n", fn.c_str());
+	else
+		fprintf(fh, "/*\ninline wchar_t %s(wchar_t ch)\n{\n", fn.c_str());
+
+	switch (t.type)
+	{
+	case layout_latin1:
+		fprintf(fh, "\textern const wchar_t %s[];\n", nm);
+		fprintf(fh, "\treturn (ch < 0x100) ? %s[ch] : ch;\n", nm);
+		break;
+
+	case layout_pair:
+		fprintf(fh, "\textern const uint8_t  %s_idx[];\n", nm);
+		fprintf(fh, "\textern const uint16_t %s_off[];\n", nm);
+		fprintf(fh, "\textern const wchar_t  %s_dat[];\n", nm);
+		fprintf(fh, "\n");
+		fprintf(fh, "\tconst wchar_t * p = %s_dat + %s_off[ %s_idx[ch >> %d] ] + ((ch & 0x%02x) << 1);\n",
+			nm, nm, nm, t.b, bmask);
+		fprintf(fh, "\t*lower = ch + p[0];\n");
+		fprintf(fh, "\t*upper = ch + p[1];\n");
+		break;
+
+	case layout_single:
+		fprintf(fh, "\textern const wchar_t %s[];\n", nm);
+		fprintf(fh, "\treturn ch + %s[ %s[ch >> %d] + (ch & 0x%02x) ];\n",
+			nm, nm, t.b, bmask);
+		break;
+
+	case layout_single_ex:
+		fprintf(fh, "\textern const uint8_t  %s_idx[];\n", nm);
+		fprintf(fh, "\textern const uint16_t %s_off[];\n", nm);
+		fprintf(fh, "\textern const wchar_t  %s_dat[];\n", nm);
+		fprintf(fh, "\treturn ch + %s_dat[ %s_off[ %s_idx[ch >> %d] ] + (ch & 0x%02x) ];\n",
+			nm, nm, nm, t.b, bmask);
+		break;
+
+	case layout_double:
+		fprintf(fh, "\textern const wchar_t %s[];\n", nm);
+		fprintf(fh, "\treturn ch + %s[ %s[ %s[ch >> %d] + ((ch >> %d) & 0x%02x) ] + (ch & 0x%02x) ];\n",
+			nm, nm, nm, t.b + t.s, t.b, smask, bmask);
+		break;
+
+	case layout_double_ex:
+		fprintf(fh, "\textern const uint8_t  %s_idx1[];\n", nm);
+		fprintf(fh, "\textern const uint16_t %s_off1[];\n", nm);
+		fprintf(fh, "\textern const uint8_t  %s_idx2[];\n", nm);
+		fprintf(fh, "\textern const uint16_t %s_off2[];\n", nm);
+		fprintf(fh, "\textern const wchar_t  %s_dat[];\n", nm);
+		fprintf(fh, "\n");
+		fprintf(fh, "\tsize_t block = %s_idx2[ %s_off1[ %s_idx1[ch >> %d] ] + ((ch >> %d) & 0x%02x) ];\n",
+			nm, nm, nm, t.b + t.s, t.b, smask);
+		fprintf(fh, "\treturn ch + %s_dat[ %s_off2[ block ] + (ch & 0x%02x) ];\n",
+			nm, nm, bmask);
+		break;
+
+	case layout_astral:
+		fprintf(fh, "\textern const uint8_t  %s_idx0[];\n", nm);
+		fprintf(fh, "\textern const uint16_t %s_off0[];\n", nm);
+		fprintf(fh, "\textern const uint8_t  %s_idx1[];\n", nm);
+		fprintf(fh, "\textern const uint16_t %s_off1[];\n", nm);
+		fprintf(fh, "\textern const uint8_t  %s_idx2[];\n", nm);
+		fprintf(fh, "\textern const uint16_t %s_off2[];\n", nm);
+		fprintf(fh, "\textern const uint16_t %s_dat[];\n", nm);
+		fprintf(fh, "\n");
+		fprintf(fh, "\tsize_t seq   = %s_idx1[ %s_off0[ %s_idx0[ch >> %d] ] + ((ch >> %d) & 0x%02x) ];\n",
+			nm, nm, nm, t.b + t.s + t.c, t.b + t.s, cmask);
+		fprintf(fh, "\tsize_t block = %s_idx2[ %s_off1[ seq ] + ((ch >> %d) & 0x%02x) ];\n",
+			nm, nm, t.b, smask);
+		fprintf(fh, "\treturn ch + (int16_t)%s_dat[ %s_off2[ block ] + (ch & 0x%02x) ];\n",
+			nm, nm, bmask);
+		break;
+	}
+
+	fprintf(fh, "}\n");
+
+	if (exp.size())
+	{
+		fprintf(fh, "\n");
+		fprintf(fh, "If the result is a surrogate, but 'ch' is not, then 'ch' folds into\n");
+		fprintf(fh, "%s_exp[result - 0xD800] characters that follow it there.\n", nm);
+	}
+
+	fprintf(fh, "*/\n\n");
+
+	switch (t.type)
+	{
+	case layout_latin1:
+		emit_array(fh, "wchar_t", name, t.dat);
+		break;
+
+	case layout_pair:
+		emit_array(fh, "uint8_t", name + "_idx", t.idx1);
+		fprintf(fh, "\n");
+		emit_array(fh, "uint16_t", name + "_off", t.off1);
+		fprintf(fh, "\n");
+		emit_array(fh, "wchar_t", name + "_dat", t.dat);
+		break;
+
+	case layout_single:
+		fprintf(fh, "const wchar_t %s[%zu] = \n{\n", nm, t.dat.size());
+		fprintf(fh, "\t/* index */\n");
+		emit_values(fh, t.dat, 0, t.jndex, false);
+		fprintf(fh, "\t/* data */\n");
+		emit_values(fh, t.dat, t.jndex, t.dat.size(), false);
+		fprintf(fh, "};\n");
+		break;
+
+	case layout_single_ex:
+		emit_array(fh, "uint8_t", name + "_idx", t.idx1);
+		fprintf(fh, "\n");
+		emit_array(fh, "uint16_t", name + "_off", t.off1);
+		fprintf(fh, "\n");
+		emit_array(fh, "wchar_t", name + "_dat", t.dat);
+		break;
+
+	case layout_double:
+		fprintf(fh, "const wchar_t %s[%zu] = \n{\n", nm, t.dat.size());
+		fprintf(fh, "\t/* index sequence offsets */\n");
+		emit_values(fh, t.dat, 0, t.jndex, false);
+		fprintf(fh, "\t/* index sequence values */\n");
+		emit_values(fh, t.dat, t.jndex, t.jndex + t.seqs, false);
+		fprintf(fh, "\t/* casemap */\n");
+		emit_values(fh, t.dat, t.jndex + t.seqs, t.dat.size(), false);
+		fprintf(fh, "};\n");
+		break;
+
+	case layout_double_ex:
+		emit_array(fh, "uint8_t", name + "_idx1", t.idx1);
+		fprintf(fh, "\n");
+		emit_array(fh, "uint16_t", name + "_off1", t.off1);
+		fprintf(fh, "\n");
+		emit_array(fh, "uint8_t", name + "_idx2", t.idx2);
+		fprintf(fh, "\n");
+		emit_array(fh, "uint16_t", name + "_off2", t.off2);
+		fprintf(fh, "\n");
+		emit_array(fh, "wchar_t", name + "_dat", t.dat);
+		break;
+
+	case layout_astral:
+		emit_array(fh, "uint8_t", name + "_idx0", t.idx0);
+		fprintf(fh, "\n");
+		emit_array(fh, "uint16_t", name + "_off0", t.off0);
+		fprintf(fh, "\n");
+		emit_array(fh, "uint8_t", name + "_idx1", t.idx1);
+		fprintf(fh, "\n");
+		emit_array(fh, "uint16_t", name + "_off1", t.off1);
+		fprintf(fh, "\n");
+		emit_array(fh, "uint8_t", name + "_idx2", t.idx2);
+		fprintf(fh, "\n");
+		emit_array(fh, "uint16_t", name + "_off2", t.off2);
+		fprintf(fh, "\n");
+		emit_array(fh, "uint16_t", name + "_dat", t.dat);
+		break;
+	}
+
+	if (exp.size())
+	{
+		fprintf(fh, "\n");
+		emit_array(fh, "wchar_t", name + "_exp", exp);
+	}
+}
+
+/*
+ *	Sweep
+ */
+static void sweep(const array_t & delta, unsigned threads)
+{
+	struct result
+	{
+		size_t  used, items;
+		size_t  single, single_ex;
+		size_t  dbl, dbl_s;
+		size_t  dbl_ex, dbl_ex_s;
+	};
+
+	std::vector<squished>  data(12);
+	std::vector<result>    res(12);
+	std::vector<std::pair<int, int>> jobs;
+	std::vector<size_t>    seq_items(12 * 16), seq_uniques(12 * 16);
+	auto t0 = std::chrono::steady_clock::now();
+	double sec;
+
+	/* data squish, for every block size */
+	parallel_for(11, threads, [&](size_t i)
+	{
+		data[i+1] = squish(delta, (size_t)1 << (i+1), 1);
+	});
+
+	/* index squish, for every block size and every sequence size */
+	for (int b = 1; b <= 11; b++)
+		for (int s = 1; b + s <= 15; s++)
+			jobs.push_back(std::make_pair(b, s));
+
+	parallel_for(jobs.size(), threads, [&](size_t i)
+	{
+		int b = jobs[i].first;
+		int s = jobs[i].second;
+		array_t  index(data[b].blk.id.begin(), data[b].blk.id.end());
+		squished sq = squish(index, (size_t)1 << s, 1);
+
+		seq_items[b*16 + s] = sq.data.size();
+		seq_uniques[b*16 + s] = sq.blk.unique.size();
+	});
+
+	for (int b = 1; b <= 11; b++)
+	{
+		result & r = res[b];
+		size_t index = (size_t)0x10000 >> b;
+		size_t used = data[b].blk.unique.size();
+
+		r.used = used;
+		r.items = data[b].data.size();
+		r.single = (index + r.items) * 2;
+		r.single_ex = index + (used + r.items) * 2;
+		r.dbl = r.dbl_ex = (size_t)-1;
+		r.dbl_s = r.dbl_ex_s = 0;
+
+		for (int s = 1; b + s <= 15; s++)
+		{
+			size_t jndex = index >> s;
+			size_t seqs  = seq_items[b*16 + s];
+			size_t dbl    = (jndex + seqs + r.items) * 2;
+			size_t dbl_ex = jndex + seqs + (seq_uniques[b*16 + s] + used + r.items) * 2;
+
+			if (dbl < r.dbl)
+				r.dbl = dbl, r.dbl_s = s;
+
+			if (used <= 0x100 && seq_uniques[b*16 + s] <= 0x100 && dbl_ex < r.dbl_ex)
+				r.dbl_ex = dbl_ex, r.dbl_ex_s = s;
+		}
+	}
+
+	sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+	printf("    Block size  |  Used blocks  |  Items  |  single  |  single-ex  |     double     |    double-ex\n\n");
+
+	for (int b = 11; b >= 1; b--)
+	{
+		const result & r = res[b];
+
+		printf("      %5zu         %5zu       %5zu     %6zu     ",
+			(size_t)1 << b, r.used, r.items, r.single);
+
+		if (r.used <= 0x100)
+			printf("  %6zu   ", r.single_ex);
+		else
+			printf("       -   ");
+
+		if (r.dbl_s)
+			printf("   %6zu (%3zu)", r.dbl, (size_t)1 << r.dbl_s);
+		else
+			printf("        -      ");
+
+		if (r.dbl_ex_s)
+			printf("   %6zu (%3zu)", r.dbl_ex, (size_t)1 << r.dbl_ex_s);
+		else
+			printf("        -      ");
+
+		printf("\n");
+	}
+
+	printf("\n    Table sizes are in bytes, sequence sizes are in (parenthesis). Took %.2f sec.\n", sec);
+}
+
+/*
+ *
+ */
+int main(int argc, char ** argv)
+{
+	bool     upper = false;
+	bool     do_sweep = false;
+	bool     astral = false;
+	bool     fold = false;
+	layout   type = layout_single;
+	int      b = -1, s = -1, c = -1;
+	uint32_t first, last;
+	unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+	const char * input = NULL;
+	std::string  output;
+	std::vector<uint32_t> map;
+	multi_t  multi;
+	array_t  delta;
+	array_t  exp;
+	array_t  upper_delta;
+	std::vector<uint32_t> upper_map;
+	std::string kind, sfx;
+	const char * tag;
+	tables   t;
+	FILE   * fh;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char * arg = argv[i];
+		const char * val = (i+1 < argc) ? argv[i+1] : NULL;
+
+		if (! strcmp(arg, "-l")) upper = false; else
+		if (! strcmp(arg, "-u")) upper = true;  else
+		if (! strcmp(arg, "-S")) do_sweep = true; else
+		if (! strcmp(arg, "-A")) astral = true; else
+		if (! strcmp(arg, "-f")) fold = true; else
+		if (arg[0] == '-' && strchr("tbscoj", arg[1]) && ! arg[2])
+		{
+			if (! val)
+				die("missing value for ", arg);
+			i++;
+
+			switch (arg[1])
+			{
+			case 't':
+				if (! strcmp(val, "single"))    type = layout_single;    else
+				if (! strcmp(val, "single-ex")) type = layout_single_ex; else
+				if (! strcmp(val, "double"))    type = layout_double;    else
+				if (! strcmp(val, "double-ex")) type = layout_double_ex; else
+				if (! strcmp(val, "latin1"))    type = layout_latin1;    else
+				if (! strcmp(val, "pair"))      type = layout_pair;      else
+					die("unknown layout ", val);
+				break;
+			case 'b': b = atoi(val); break;
+			case 's': s = atoi(val); break;
+			case 'c': c = atoi(val); break;
+			case 'o': output = val; break;
+			case 'j': threads = std::max(1, atoi(val)); break;
+			}
+		}
+		else
+		if (arg[0] != '-' && ! input)
+		{
+			input = arg;
+		}
+		else
+		{
+			die("bad argument ", arg);
+		}
+	}
+
+	if (! input)
+		die("usage: casemap_gen [-l|-u] [-t single|single-ex|double|double-ex|latin1|pair] [-b bits] [-s bits] [-o file] [-j threads] [-S] [-A [-c bits]] [-f] <input>");
+
+	if (type == layout_pair)
+		upper = false;
+
+	map = fold ? load_folding(input, multi) : load_mapping(input, upper);
+
+	/* BMP or planes 1 - 16, leaving the other part out */
+	first = astral ? 0x10000 : 0;
+	last  = astral ? 0x10ffff : 0xffff;
+
+	delta.resize(last + 1);
+
+	for (uint32_t ch = first; ch <= last; ch++)
+	{
+		int32_t d = (int32_t)map[ch] - (int32_t)ch;
+
+		if (map[ch] < first || map[ch] > last)
+			map[ch] = ch;
+		else
+		if (astral && (d < -0x8000 || d > 0x7fff))
+			die("astral case deltas must fit into 16 bits");
+		else
+			delta[ch] = (uint16_t)d;
+	}
+
+	/* one-to-many folds - a sentinel delta into the expansions */
+	for (auto & m : multi)
+	{
+		uint32_t ch = m.first;
+
+		if (ch < first || ch > last)
+			continue;
+
+		if (astral)
+			die("one-to-many folds are for BMP characters only");
+
+		map[ch] = 0xd800 + (uint32_t)exp.size();
+		delta[ch] = (uint16_t)(map[ch] - ch);
+
+		exp.push_back((uint16_t)m.second.size());
+		for (auto to : m.second)
+		{
+			if (to > 0xffff)
+				die("one-to-many folds must be into the BMP");
+			exp.push_back((uint16_t)to);
+		}
+
+		if (exp.size() > 0x800)
+			die("too many one-to-many folds");
+	}
+
+	if (do_sweep)
+	{
+		if (astral)
+			die("-S is for the BMP tables only");
+
+		sweep(delta, threads);
+		return 0;
+	}
+
+	if (astral)
+	{
+		t = search_astral(delta, b, s, c, threads);
+		goto check;
+	}
+
+	/* defaults - the best ones for Unicode 13 */
+	if (b < 0 && type != layout_pair)
+		b = (type == layout_single) ? 6 : (type == layout_single_ex) ? 5 : 3;
+
+	if (s < 0)
+		s = 5;
+
+	if ((b < 1 && type != layout_pair) || b > 15)
+		die("block size is out of range");
+
+	if (type == layout_latin1)
+	{
+		t = build_latin1(delta);
+		last = 0xff;
+	}
+	else
+	if (type == layout_pair)
+	{
+		/* upper case is field 12 of UnicodeData.txt or the mapping, reversed if need be */
+		std::vector<uint32_t> umap = load_mapping(input, true);
+
+		for (uint32_t ch = 0; ch < 0x10000; ch++)
+		{
+			upper_map.push_back((umap[ch] < 0x10000) ? umap[ch] : ch);
+			upper_delta.push_back((uint16_t)(upper_map[ch] - ch));
+		}
+
+		if (b > 0)
+			t = build_pair(delta, upper_delta, b, threads);
+		else
+			for (int bb = 3; bb <= 7; bb++)
+			{
+				tables tt = build_pair(delta, upper_delta, bb, threads);
+				if (bb == 3 || tt.bytes() < t.bytes())
+					t = tt;
+			}
+
+		for (uint32_t ch = 0; ch < 0x10000; ch++)
+			if (lookup(t, ch, true) != (uint16_t)upper_map[ch])
+				die("self-check failed, this is a bug");
+	}
+	else
+	if (type == layout_single || type == layout_single_ex)
+	{
+		t = build_single(delta, b, threads, type == layout_single_ex);
+	}
+	else
+	{
+		if (s < 1 || b + s > 16)
+			die("sequence size is out of range");
+
+		squished data = squish(delta, (size_t)1 << b, threads);
+		t = build_double(data, b, s, threads, type == layout_double_ex);
+	}
+
+check:
+	for (uint32_t ch = first; ch <= last; ch++)
+		if (lookup(t, ch) != (uint16_t)map[ch])
+			die("self-check failed, this is a bug");
+
+	kind = fold ? "casefold" : (type == layout_pair) ? "casepair" : upper ? "toupper" : "tolower";
+	tag  = fold ? "f" : (type == layout_pair) ? "p" : upper ? "u" : "l";
+	sfx  = astral ? std::string("astral") : (type == layout_latin1) ? std::string("latin1") : std::to_string(t.bytes());
+
+	if (output.empty())
+		output = kind + "_" + sfx + ".c";
+
+	fh = fopen(output.c_str(), "wb");
+	if (! fh)
+		die("failed to create ", output.c_str());
+
+	emit(fh, t, kind + "_" + sfx, std::string("casemap_") + tag + "_" + sfx, exp);
+	fclose(fh);
+
+	if (astral)
+		printf("%s - %zu bytes, block sizes %d / %d / %d\n", output.c_str(), t.bytes(), 1 << t.b, 1 << t.s, 1 << t.c);
+	else
+	if (exp.size())
+		printf("%s - %zu bytes, plus %zu bytes of expansions\n", output.c_str(), t.bytes(), exp.size() * 2);
+	else
+		printf("%s - %zu bytes\n", output.c_str(), t.bytes());
+	return 0;
+}
@@ -0,0 +1,28 @@
+/*
+ *	Fast character case conversion
+ *	https://github.com/apankrat/notes/blob/master/fast-case-conversion
+ *
+ *	The table files are bare arrays with no #includes of their
+ *	own, so they are compiled here, in one translation unit.
+ */
+#include "casemap.h"
+
+#include "tolower_1618.c"
+#include "tolower_2112.c"
+#include "tolower_4422.c"
+#include "tolower_5750.c"
+
+#include "toupper_1738.c"
+#include "toupper_2258.c"
+#include "toupper_4638.c"
+#include "toupper_5866.c"
+
+#include "casepair_8358.c"
+
+#include "tolower_latin1.c"
+#include "toupper_latin1.c"
+
+#include "tolower_astral.c"
+#include "toupper_astral.c"
+
+#include "casefold_6208.c"
@@ -0,0 +1,220 @@
+/*
+ *	Fast character case conversion
+ *	https://github.com/apankrat/notes/blob/master/fast-case-conversion
+ *
+ *	UTF-8 case conversion in one pass - decode, look up, re-encode.
+ *
+ *	ASCII runs are converted 16 bytes at a time with SSE2 / NEON.
+ *	Everything else is decoded and mapped through the 5750 / 5866
+ *	tables, the same as tolower_n() / toupper_n(), or through the
+ *	astral ones for 4-byte sequences.
+ *
+ *	The encoded length of a character may change with its case,
+ *	e.g. U+023A (2 bytes) lowers to U+2C65 (3 bytes) and U+2C6F
+ *	(3 bytes) lowers to U+0250 (2 bytes). The output is therefore
+ *	never longer than 3/2 of the input.
+ *
+ *	Astral case pairs are all 4 bytes on both sides, so that
+ *	doesn't change the bound.
+ *
+ *	Invalid and overlong sequences and encoded surrogates are
+ *	copied through byte by byte.
+ */
+#include "casemap.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+static inline int is_cont(uint8_t c)
+{
+	return (c & 0xc0) == 0x80;
+}
+
+/*
+ *	Decodes one 2-, 3- or 4-byte sequence. Returns its length or 0
+ *	if it's not a valid one.
+ */
+static inline size_t decode(const uint8_t * s, size_t len, char32_t * ch)
+{
+	uint32_t cp;
+
+	if (0xc2 <= s[0] && s[0] <= 0xdf)
+	{
+		if (len < 2 || ! is_cont(s[1]))
+			return 0;
+
+		*ch = ((s[0] & 0x1f) << 6) | (s[1] & 0x3f);
+		return 2;
+	}
+
+	if ((s[0] & 0xf0) == 0xe0)
+	{
+		if (len < 3 || ! is_cont(s[1]) || ! is_cont(s[2]))
+			return 0;
+
+		cp = ((s[0] & 0x0f) << 12) | ((s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+		if (cp < 0x800 || (0xd800 <= cp && cp <= 0xdfff))
+			return 0;
+
+		*ch = cp;
+		return 3;
+	}
+
+	if (0xf0 <= s[0] && s[0] <= 0xf4)
+	{
+		if (len < 4 || ! is_cont(s[1]) || ! is_cont(s[2]) || ! is_cont(s[3]))
+			return 0;
+
+		cp = ((s[0] & 0x07) << 18) | ((s[1] & 0x3f) << 12) | ((s[2] & 0x3f) << 6) | (s[3] & 0x3f);
+		if (cp < 0x10000 || cp > 0x10ffff)
+			return 0;
+
+		*ch = cp;
+		return 4;
+	}
+
+	return 0;
+}
+
+static inline size_t encode(uint8_t * d, char32_t ch)
+{
+	if (ch < 0x80)
+	{
+		d[0] = (uint8_t)ch;
+		return 1;
+	}
+
+	if (ch < 0x800)
+	{
+		d[0] = (uint8_t)(0xc0 | (ch >> 6));
+		d[1] = (uint8_t)(0x80 | (ch & 0x3f));
+		return 2;
+	}
+
+	if (ch < 0x10000)
+	{
+		d[0] = (uint8_t)(0xe0 | (ch >> 12));
+		d[1] = (uint8_t)(0x80 | ((ch >> 6) & 0x3f));
+		d[2] = (uint8_t)(0x80 | (ch & 0x3f));
+		return 3;
+	}
+
+	d[0] = (uint8_t)(0xf0 | (ch >> 18));
+	d[1] = (uint8_t)(0x80 | ((ch >> 12) & 0x3f));
+	d[2] = (uint8_t)(0x80 | ((ch >> 6) & 0x3f));
+	d[3] = (uint8_t)(0x80 | (ch & 0x3f));
+	return 4;
+}
+
+/*
+ *	Converts up to 16 ASCII bytes, returns how many were done
+ */
+static inline size_t ascii16(uint8_t * d, const uint8_t * s, uint8_t lo, uint8_t hi, uint8_t delta)
+{
+#if defined(__SSE2__)
+	__m128i v = _mm_loadu_si128((const __m128i *)s);
+	__m128i m;
+
+	if (_mm_movemask_epi8(v))
+		return 0;
+
+	m = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)(lo - 1))), _mm_cmpgt_epi8(_mm_set1_epi8((char)(hi + 1)), v));
+	_mm_storeu_si128((__m128i *)d, _mm_add_epi8(v, _mm_and_si128(m, _mm_set1_epi8((char)delta))));
+	return 16;
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	uint8x16_t v = vld1q_u8(s);
+	uint8x16_t m;
+
+	if (vmaxvq_u8(v) >= 0x80)
+		return 0;
+
+	m = vandq_u8(vcgeq_u8(v, vdupq_n_u8(lo)), vcleq_u8(v, vdupq_n_u8(hi)));
+	vst1q_u8(d, vaddq_u8(v, vandq_u8(m, vdupq_n_u8(delta))));
+	return 16;
+
+#else
+	(void)d; (void)s; (void)lo; (void)hi; (void)delta;
+	return 0;
+#endif
+}
+
+static size_t utf8_casemap(char * dst, size_t dst_max, const char * src, size_t src_len,
+                           const wchar_t * table, char32_t (* astral)(char32_t),
+                           uint8_t lo, uint8_t hi, uint8_t delta)
+{
+	const uint8_t * s = (const uint8_t *)src;
+	const uint8_t * end = s + src_len;
+	uint8_t * d = (uint8_t *)dst;
+	size_t out = 0;
+
+	while (s < end)
+	{
+		const uint8_t * p;
+		uint8_t  buf[4];
+		size_t   n, k, i;
+		char32_t ch;
+
+		if (end - s >= 16 && out + 16 <= dst_max)
+		{
+			n = ascii16(d + out, s, lo, hi, delta);
+			if (n)
+			{
+				s += n;
+				out += n;
+				continue;
+			}
+		}
+
+		if (*s < 0x80)
+		{
+			ch = *s;
+			n = 1;
+		}
+		else
+		{
+			n = decode(s, end - s, &ch);
+		}
+
+		if (n)
+		{
+			if (ch < 0x10000)
+				ch = (wchar_t)(ch + table[ table[ch >> 6] + (ch & 0x3f) ]);
+			else
+				ch = astral(ch);
+
+			k = encode(buf, ch);
+			p = buf;
+		}
+		else
+		{
+			/* pass through - one byte of an invalid sequence */
+			n = k = 1;
+			p = s;
+		}
+
+		for (i = 0; i < k; i++, out++)
+			if (out < dst_max)
+				d[out] = p[i];
+
+		s += n;
+	}
+
+	return out;
+}
+
+/*
+ *	API
+ */
+size_t utf8_tolower(char * dst, size_t dst_max, const char * src, size_t src_len)
+{
+	return utf8_casemap(dst, dst_max, src, src_len, casemap_l_5750, tolower_astral, 'A', 'Z', 'a' - 'A');
+}
+
+size_t utf8_toupper(char * dst, size_t dst_max, const char * src, size_t src_len)
+{
+	return utf8_casemap(dst, dst_max, src, src_len, casemap_u_5866, toupper_astral, 'a', 'z', (uint8_t)('A' - 'a'));
+}
@@ -0,0 +1,76 @@
+/*
+inline char32_t toupper_astral(char32_t ch)
+{
+	extern const uint8_t  casemap_u_astral_idx0[];
+	extern const uint16_t casemap_u_astral_off0[];
+	extern const uint8_t  casemap_u_astral_idx1[];
+	extern const uint16_t casemap_u_astral_off1[];
+	extern const uint8_t  casemap_u_astral_idx2[];
+	extern const uint16_t casemap_u_astral_off2[];
+	extern const uint16_t casemap_u_astral_dat[];
+
+	size_t seq   = casemap_u_astral_idx1[ casemap_u_astral_off0[ casemap_u_astral_idx0[ch >> 14] ] + ((ch >> 8) & 0x3f) ];
+	size_t block = casemap_u_astral_idx2[ casemap_u_astral_off1[ seq ] + ((ch >> 3) & 0x1f) ];
+	return ch + (int16_t)casemap_u_astral_dat[ casemap_u_astral_off2[ block ] + (ch & 0x07) ];
+}
+*/
+
+const uint8_t casemap_u_astral_idx0[68] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 
+};
+
+const uint16_t casemap_u_astral_off0[4] = 
+{
+	0x0043, 0x0000, 0x0055, 0x0019, 
+};
+
+const uint8_t casemap_u_astral_idx1[149] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+const uint16_t casemap_u_astral_off1[6] = 
+{
+	0x0025, 0x004c, 0x002d, 0x0009, 0x0015, 0x0000, 
+};
+
+const uint8_t casemap_u_astral_idx2[108] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x07, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 
+};
+
+const uint16_t casemap_u_astral_off2[9] = 
+{
+	0x0028, 0x0000, 0x0004, 0x0020, 0x0025, 0x0018, 0x000a, 0x000c, 
+	0x0010, 
+};
+
+const uint16_t casemap_u_astral_dat[48] = 
+{
+	0xffd8, 0xffd8, 0xffd8, 0xffd8, 0xffd8, 0xffd8, 0xffd8, 0xffd8, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xffde, 0xffde, 0xffde, 0xffde, 
+	0xffde, 0xffde, 0xffde, 0xffde, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 
+	0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+};
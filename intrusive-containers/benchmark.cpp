@@ -0,0 +1,968 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+
+/*
+ *	Intrusive containers vs std:: and Boost.Intrusive
+ *
+ *		g++ -O2 -std=c++11 -pthread benchmark.cpp -o benchmark
+ *		./benchmark [max_items [items_per_thread]]
+ *
+ *	Boost is header-only here, so it just needs to be on the
+ *	include path.
+ *
+ *	All containers hold the same struct, which has the links for
+ *	all of them, so the items are the same size. Each test sizes
+ *	the item count from L1-resident to DRAM-resident and then runs
+ *	with 1, 2, 4, ... threads, each on its own containers, which
+ *	is where the allocator starts to matter.
+ *
+ *	For each op it reports the ns, heap allocations and cache misses
+ *	per op. The misses are from perf_event_open() and show as '-'
+ *	if that's not permitted, see /proc/sys/kernel/perf_event_paranoid.
+ *
+ *	Items are allocated together, but linked in random order, so
+ *	traversals jump around the memory like they would in a program
+ *	that has been running for a while.
+ *
+ *	The containers that are meant to be shared between threads -
+ *	the MPSC queue, the stack and the skip list - are shared by
+ *	all threads instead and are compared against their std::
+ *	counterparts behind a mutex. For the queue, one thread is the
+ *	consumer and the rest are producers.
+ */
+#include "linked_list.h"
+#include "hash_table.h"
+#include "rb_tree.h"
+#include "pairing_heap.h"
+#include "lru.h"
+#include "timer_wheel.h"
+#include "mpsc_queue.h"
+#include "lockfree_stack.h"
+#include "skiplist.h"
+
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/set.hpp>
+#include <boost/intrusive/unordered_set.hpp>
+
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <queue>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <random>
+#include <new>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bi = boost::intrusive;
+
+typedef bi::link_mode<bi::normal_link> fast_link;
+
+/*
+ *	The item
+ */
+struct obj
+{
+	uint64_t  key;
+	uint64_t  payload;
+
+	DLIST_ITEM     d1;
+	DLIST_ITEM     d2;
+	HASH_ITEM      h;
+	TREE_ITEM      t;
+	HEAP_ITEM      p;
+	TIMER_ITEM     tm;
+	MPSC_ITEM      q;
+	STACK_ITEM     s;
+	SKIPLIST_ITEM  sk;
+
+	bi::list_member_hook<fast_link>           b1;
+	bi::list_member_hook<fast_link>           b2;
+	bi::unordered_set_member_hook<fast_link>  bh;
+	bi::set_member_hook<fast_link>            bt;
+
+	std::list<obj*>::iterator  i1;
+	std::list<obj*>::iterator  i2;
+
+	std::multimap<uint64_t, obj*>::iterator  ti;
+
+	friend bool operator == (const obj & a, const obj & b) { return a.key == b.key; }
+	friend bool operator <  (const obj & a, const obj & b) { return a.key < b.key; }
+};
+
+CONTAINER_OF(obj, d1)
+CONTAINER_OF(obj, d2)
+CONTAINER_OF(obj, h)
+CONTAINER_OF(obj, t)
+CONTAINER_OF(obj, p)
+CONTAINER_OF(obj, tm)
+CONTAINER_OF(obj, q)
+CONTAINER_OF(obj, s)
+CONTAINER_OF(obj, sk)
+
+struct mix_hash
+{
+	size_t operator () (uint64_t k)     const { return hash_mix(k); }
+	size_t operator () (const obj & o) const { return hash_mix(o.key); }
+};
+
+struct key_equal
+{
+	bool operator () (uint64_t k, const obj & o) const { return k == o.key; }
+};
+
+struct key_less
+{
+	bool operator () (uint64_t k, const obj & o) const { return k < o.key; }
+	bool operator () (const obj & o, uint64_t k) const { return o.key < k; }
+};
+
+struct heap_less
+{
+	static bool less(const obj * a, const obj * b) { return a->key < b->key; }
+};
+
+struct heap_greater
+{
+	bool operator () (const obj * a, const obj * b) const { return a->key > b->key; }
+};
+
+/* the items are in a vector, the skip list shouldn't free them */
+struct no_dispose
+{
+	static void dispose(obj *) { }
+};
+
+typedef INTRUSIVE_LRU(obj, h, d1, key)  lru_cache;
+
+typedef SKIPLIST_HEAD(obj, sk, key, skip_less<uint64_t>, no_dispose)  skip_map;
+
+typedef bi::list<obj, bi::member_hook<obj, bi::list_member_hook<fast_link>, &obj::b1>> boost_list1;
+typedef bi::list<obj, bi::member_hook<obj, bi::list_member_hook<fast_link>, &obj::b2>> boost_list2;
+
+typedef bi::unordered_set<obj, bi::member_hook<obj, bi::unordered_set_member_hook<fast_link>, &obj::bh>,
+                          bi::hash<mix_hash>, bi::power_2_buckets<true>> boost_hash;
+
+typedef bi::multiset<obj, bi::member_hook<obj, bi::set_member_hook<fast_link>, &obj::bt>> boost_tree;
+
+/*
+ *	Allocation counting
+ */
+static thread_local uint64_t allocs = 0;
+
+void * operator new (size_t n)
+{
+	void * p;
+
+	allocs++;
+	if (! (p = malloc(n ? n : 1)))
+		throw std::bad_alloc();
+
+	return p;
+}
+
+void operator delete (void * p) noexcept { free(p); }
+void operator delete (void * p, size_t) noexcept { free(p); }
+
+/*
+ *	Cache misses, from this thread only
+ */
+struct miss_counter
+{
+	int fd;
+
+	miss_counter() : fd(-1)
+	{
+#ifdef __linux__
+		perf_event_attr attr;
+
+		memset(&attr, 0, sizeof attr);
+		attr.size = sizeof attr;
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.config = PERF_COUNT_HW_CACHE_MISSES;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+
+		fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+	}
+
+	~miss_counter()
+	{
+#ifdef __linux__
+		if (fd >= 0) close(fd);
+#endif
+	}
+
+	uint64_t read() const
+	{
+		uint64_t v = 0;
+#ifdef __linux__
+		if (fd >= 0 && ::read(fd, &v, sizeof v) != sizeof v)
+			v = 0;
+#endif
+		return v;
+	}
+};
+
+/*
+ *	Measurements
+ */
+enum op_type { INSERT, TRAVERSE, FIND, ERASE, MULTI_ERASE, POP, FIRE, OPS };
+
+static const char * op_name[OPS] = { "insert", "traverse", "find", "erase", "erase x2", "pop", "fire" };
+
+struct counters
+{
+	double    ns;
+	uint64_t  ops;
+	uint64_t  allocs;
+	uint64_t  misses;
+	bool      have_misses;
+
+	counters() : ns(0), ops(0), allocs(0), misses(0), have_misses(false) { }
+
+	void operator += (const counters & c)
+	{
+		ns += c.ns;
+		ops += c.ops;
+		allocs += c.allocs;
+		misses += c.misses;
+		have_misses = c.have_misses;
+	}
+};
+
+typedef counters results[OPS];
+
+/*
+ *	Times a section of a test, e.g.
+ *
+ *		{ phase x(res[FIND], n, mc); ... }
+ */
+struct phase
+{
+	counters           & c;
+	uint64_t             ops;
+	const miss_counter & mc;
+	uint64_t             allocs0;
+	uint64_t             misses0;
+
+	std::chrono::steady_clock::time_point  start;
+
+	phase(counters & c_, uint64_t ops_, const miss_counter & mc_)
+		: c(c_), ops(ops_), mc(mc_), allocs0(allocs), misses0(mc.read()), start(std::chrono::steady_clock::now()) { }
+
+	~phase()
+	{
+		c.ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		c.ops += ops;
+		c.allocs += allocs - allocs0;
+		c.misses += mc.read() - misses0;
+		c.have_misses = mc.fd >= 0;
+	}
+};
+
+/*
+ *	Test data - the items, their keys and two random orders
+ */
+struct data
+{
+	std::vector<obj>     items;
+	std::vector<obj*>    order;    /* to link in */
+	std::vector<obj*>    lookup;   /* to find and erase in */
+	volatile uint64_t    sink;
+
+	data(size_t n, unsigned seed) : items(n), sink(0)
+	{
+		std::mt19937_64 rng(seed);
+
+		for (auto & o : items)
+		{
+			o.key = rng();
+			o.payload = 1;
+			order.push_back(&o);
+		}
+
+		lookup = order;
+		std::shuffle(order.begin(), order.end(), rng);
+		std::shuffle(lookup.begin(), lookup.end(), rng);
+	}
+};
+
+/*
+ *	Tests, one per container
+ */
+static void test_dlist(data & d, results & r, const miss_counter & mc)
+{
+	DLIST_HEAD(obj, d1)  l1;
+	DLIST_HEAD(obj, d2)  l2;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{ phase x(r[INSERT], n, mc);   for (obj * o : d.order) l1.add_tail(&o->d1); }
+	{ phase x(r[TRAVERSE], n, mc); for (obj * o : l1) sum += o->payload; }
+	{ phase x(r[ERASE], n, mc);    for (obj * o : d.lookup) l1.del(&o->d1); }
+
+	for (obj * o : d.order) l1.add_tail(&o->d1), l2.add_tail(&o->d2);
+
+	{ phase x(r[MULTI_ERASE], n, mc); for (obj * o : d.lookup) l1.del(&o->d1), l2.del(&o->d2); }
+
+	d.sink = sum;
+}
+
+static void test_std_list(data & d, results & r, const miss_counter & mc)
+{
+	std::list<obj*> l1, l2;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{ phase x(r[INSERT], n, mc);   for (obj * o : d.order) o->i1 = l1.insert(l1.end(), o); }
+	{ phase x(r[TRAVERSE], n, mc); for (obj * o : l1) sum += o->payload; }
+	{ phase x(r[ERASE], n, mc);    for (obj * o : d.lookup) l1.erase(o->i1); }
+
+	for (obj * o : d.order) o->i1 = l1.insert(l1.end(), o), o->i2 = l2.insert(l2.end(), o);
+
+	{ phase x(r[MULTI_ERASE], n, mc); for (obj * o : d.lookup) l1.erase(o->i1), l2.erase(o->i2); }
+
+	d.sink = sum;
+}
+
+static void test_boost_list(data & d, results & r, const miss_counter & mc)
+{
+	boost_list1 l1;
+	boost_list2 l2;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{ phase x(r[INSERT], n, mc);   for (obj * o : d.order) l1.push_back(*o); }
+	{ phase x(r[TRAVERSE], n, mc); for (obj & o : l1) sum += o.payload; }
+	{ phase x(r[ERASE], n, mc);    for (obj * o : d.lookup) l1.erase(l1.iterator_to(*o)); }
+
+	for (obj * o : d.order) l1.push_back(*o), l2.push_back(*o);
+
+	{ phase x(r[MULTI_ERASE], n, mc); for (obj * o : d.lookup) l1.erase(l1.iterator_to(*o)), l2.erase(l2.iterator_to(*o)); }
+
+	d.sink = sum;
+}
+
+static void test_hash(data & d, results & r, const miss_counter & mc)
+{
+	HASH_HEAD(obj, h, key)  table;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{ phase x(r[INSERT], n, mc);   for (obj * o : d.order) table.add(&o->h); }
+	{ phase x(r[FIND], n, mc);     for (obj * o : d.lookup) sum += container_of(table.find(o->key))->payload; }
+	{ phase x(r[TRAVERSE], n, mc); for (auto p = table.first(); p; p = table.next(p)) sum += container_of(p)->payload; }
+	{ phase x(r[ERASE], n, mc);    for (obj * o : d.lookup) table.del(&o->h); }
+
+	d.sink = sum;
+}
+
+static void test_std_hash(data & d, results & r, const miss_counter & mc)
+{
+	std::unordered_map<uint64_t, obj*, mix_hash> table;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{ phase x(r[INSERT], n, mc);   for (obj * o : d.order) table.emplace(o->key, o); }
+	{ phase x(r[FIND], n, mc);     for (obj * o : d.lookup) sum += table.find(o->key)->second->payload; }
+	{ phase x(r[TRAVERSE], n, mc); for (auto & kv : table) sum += kv.second->payload; }
+	{ phase x(r[ERASE], n, mc);    for (obj * o : d.lookup) table.erase(o->key); }
+
+	d.sink = sum;
+}
+
+/*
+ *	Boost's table doesn't grow on its own, the buckets are sized
+ *	up front, and that's not counted
+ */
+static void test_boost_hash(data & d, results & r, const miss_counter & mc)
+{
+	size_t n = d.items.size(), nb = 1;
+	uint64_t sum = 0;
+
+	while (nb < n) nb *= 2;
+
+	std::vector<boost_hash::bucket_type> buckets(nb);
+	boost_hash table(boost_hash::bucket_traits(buckets.data(), nb));
+
+	{ phase x(r[INSERT], n, mc);   for (obj * o : d.order) table.insert(*o); }
+	{ phase x(r[FIND], n, mc);     for (obj * o : d.lookup) sum += table.find(o->key, mix_hash(), key_equal())->payload; }
+	{ phase x(r[TRAVERSE], n, mc); for (obj & o : table) sum += o.payload; }
+	{ phase x(r[ERASE], n, mc);    for (obj * o : d.lookup) table.erase(table.iterator_to(*o)); }
+
+	d.sink = sum;
+}
+
+static void test_tree(data & d, results & r, const miss_counter & mc)
+{
+	TREE_HEAD(obj, t, key)  tree;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{ phase x(r[INSERT], n, mc);   for (obj * o : d.order) tree.add(&o->t); }
+	{ phase x(r[FIND], n, mc);     for (obj * o : d.lookup) sum += container_of(tree.find(o->key))->payload; }
+	{ phase x(r[TRAVERSE], n, mc); for (auto p = tree.first; p; p = tree.next(p)) sum += container_of(p)->payload; }
+	{ phase x(r[ERASE], n, mc);    for (obj * o : d.lookup) tree.del(&o->t); }
+
+	d.sink = sum;
+}
+
+static void test_std_tree(data & d, results & r, const miss_counter & mc)
+{
+	std::multimap<uint64_t, obj*> tree;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{ phase x(r[INSERT], n, mc);   for (obj * o : d.order) tree.emplace(o->key, o); }
+	{ phase x(r[FIND], n, mc);     for (obj * o : d.lookup) sum += tree.find(o->key)->second->payload; }
+	{ phase x(r[TRAVERSE], n, mc); for (auto & kv : tree) sum += kv.second->payload; }
+	{ phase x(r[ERASE], n, mc);    for (obj * o : d.lookup) tree.erase(tree.find(o->key)); }
+
+	d.sink = sum;
+}
+
+static void test_boost_tree(data & d, results & r, const miss_counter & mc)
+{
+	boost_tree tree;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{ phase x(r[INSERT], n, mc);   for (obj * o : d.order) tree.insert(*o); }
+	{ phase x(r[FIND], n, mc);     for (obj * o : d.lookup) sum += tree.find(o->key, key_less())->payload; }
+	{ phase x(r[TRAVERSE], n, mc); for (obj & o : tree) sum += o.payload; }
+	{ phase x(r[ERASE], n, mc);    for (obj * o : d.lookup) tree.erase(tree.iterator_to(*o)); }
+
+	d.sink = sum;
+}
+
+static void test_heap(data & d, results & r, const miss_counter & mc)
+{
+	HEAP_HEAD(obj, p, heap_less)  heap;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{ phase x(r[INSERT], n, mc); for (obj * o : d.order) heap.add(&o->p); }
+	{ phase x(r[POP], n, mc);    while (auto p = heap.pop()) sum += container_of(p)->payload; }
+
+	for (obj * o : d.order) heap.add(&o->p);
+
+	{ phase x(r[ERASE], n, mc);  for (obj * o : d.lookup) heap.del(&o->p); }
+
+	d.sink = sum;
+}
+
+/*
+ *	No erase, there's no way to get at an item in the middle
+ */
+static void test_std_heap(data & d, results & r, const miss_counter & mc)
+{
+	std::priority_queue<obj*, std::vector<obj*>, heap_greater> heap;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{ phase x(r[INSERT], n, mc); for (obj * o : d.order) heap.push(o); }
+	{ phase x(r[POP], n, mc);    for ( ; ! heap.empty(); heap.pop()) sum += heap.top()->payload; }
+
+	d.sink = sum;
+}
+
+/*
+ *	The cache holds half of the items, so every insert past that
+ *	evicts and half of the finds miss
+ */
+static void test_lru(data & d, results & r, const miss_counter & mc)
+{
+	size_t n = d.items.size();
+	lru_cache lru(n / 2);
+	uint64_t sum = 0;
+
+	{
+		phase x(r[INSERT], n, mc);
+
+		for (obj * o : d.order)
+		{
+			lru.add(o);
+			while (lru.evict())
+				;
+		}
+	}
+
+	{
+		phase x(r[FIND], n, mc);
+
+		for (obj * o : d.lookup)
+			if (obj * p = lru.find(o->key))
+				sum += p->payload;
+	}
+
+	d.sink = sum;
+}
+
+static void test_std_lru(data & d, results & r, const miss_counter & mc)
+{
+	std::list<obj*> order;
+	std::unordered_map<uint64_t, std::list<obj*>::iterator, mix_hash> table;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{
+		phase x(r[INSERT], n, mc);
+
+		for (obj * o : d.order)
+		{
+			order.push_front(o);
+			table.emplace(o->key, order.begin());
+
+			if (table.size() > n / 2)
+			{
+				table.erase(order.back()->key);
+				order.pop_back();
+			}
+		}
+	}
+
+	{
+		phase x(r[FIND], n, mc);
+
+		for (obj * o : d.lookup)
+		{
+			auto i = table.find(o->key);
+
+			if (i == table.end())
+				continue;
+
+			order.splice(order.begin(), order, i->second);
+			sum += (*i->second)->payload;
+		}
+	}
+
+	d.sink = sum;
+}
+
+/*
+ *	Timers are spread over the next 64K ticks, which is enough to
+ *	make them cascade through the first two levels of the wheel
+ */
+#define TIMER_SPAN  65536
+
+static void test_timers(data & d, results & r, const miss_counter & mc)
+{
+	TIMER_WHEEL(obj, tm)  wheel;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{ phase x(r[INSERT], n, mc); for (obj * o : d.order) wheel.schedule(&o->tm, o->key % TIMER_SPAN); }
+	{ phase x(r[ERASE], n, mc);  for (obj * o : d.lookup) wheel.cancel(&o->tm); }
+
+	for (obj * o : d.order) wheel.schedule(&o->tm, o->key % TIMER_SPAN);
+
+	{ phase x(r[FIRE], n, mc);   wheel.advance(TIMER_SPAN, [&](obj * o){ sum += o->payload; }); }
+
+	d.sink = sum;
+}
+
+static void test_std_timers(data & d, results & r, const miss_counter & mc)
+{
+	std::multimap<uint64_t, obj*> timers;
+	size_t n = d.items.size();
+	uint64_t sum = 0;
+
+	{ phase x(r[INSERT], n, mc); for (obj * o : d.order) o->ti = timers.emplace(o->key % TIMER_SPAN, o); }
+	{ phase x(r[ERASE], n, mc);  for (obj * o : d.lookup) timers.erase(o->ti); }
+
+	for (obj * o : d.order) o->ti = timers.emplace(o->key % TIMER_SPAN, o);
+
+	{
+		phase x(r[FIRE], n, mc);
+
+		for (uint64_t now = 0; now <= TIMER_SPAN; now++)
+			while (! timers.empty() && timers.begin()->first <= now)
+			{
+				sum += timers.begin()->second->payload;
+				timers.erase(timers.begin());
+			}
+	}
+
+	d.sink = sum;
+}
+
+/*
+ *	Shared tests, one per container. Each is a struct with the
+ *	container and a run() that all threads call, each with its
+ *	own data.
+ */
+struct shared_mpsc
+{
+	MPSC_HEAD(obj, q)  queue;
+
+	void run(data & d, results & r, const miss_counter & mc, unsigned i, unsigned threads)
+	{
+		size_t n = d.items.size(), total = (threads > 1) ? n * (threads - 1) : n;
+		uint64_t sum = 0;
+		size_t k;
+
+		if (i || threads == 1)
+		{
+			phase x(r[INSERT], n, mc);
+			for (obj * o : d.order) queue.push(&o->q);
+		}
+
+		if (! i)
+		{
+			phase x(r[POP], total, mc);
+			for (k = 0; k < total; )
+				if (auto p = queue.pop())
+					sum += container_of(p)->payload, k++;
+		}
+
+		d.sink = sum;
+	}
+};
+
+struct shared_std_queue
+{
+	std::mutex         lock;
+	std::deque<obj*>   queue;
+
+	void run(data & d, results & r, const miss_counter & mc, unsigned i, unsigned threads)
+	{
+		size_t n = d.items.size(), total = (threads > 1) ? n * (threads - 1) : n;
+		uint64_t sum = 0;
+		size_t k;
+
+		if (i || threads == 1)
+		{
+			phase x(r[INSERT], n, mc);
+			for (obj * o : d.order)
+			{
+				std::lock_guard<std::mutex> g(lock);
+				queue.push_back(o);
+			}
+		}
+
+		if (! i)
+		{
+			phase x(r[POP], total, mc);
+			for (k = 0; k < total; )
+			{
+				std::lock_guard<std::mutex> g(lock);
+				if (queue.empty())
+					continue;
+
+				sum += queue.front()->payload, k++;
+				queue.pop_front();
+			}
+		}
+
+		d.sink = sum;
+	}
+};
+
+/*
+ *	Every thread pushes its items and then pops as many, which
+ *	are then mostly someone else's
+ */
+struct shared_stack
+{
+	STACK_HEAD(obj, s)  stack;
+
+	void run(data & d, results & r, const miss_counter & mc, unsigned, unsigned)
+	{
+		size_t n = d.items.size(), k;
+		uint64_t sum = 0;
+
+		{ phase x(r[INSERT], n, mc); for (obj * o : d.order) stack.push(&o->s); }
+
+		{
+			phase x(r[POP], n, mc);
+			for (k = 0; k < n; )
+				if (auto p = stack.pop())
+					sum += container_of(p)->payload, k++;
+		}
+
+		d.sink = sum;
+	}
+};
+
+struct shared_std_stack
+{
+	std::mutex         lock;
+	std::vector<obj*>  stack;
+
+	void run(data & d, results & r, const miss_counter & mc, unsigned, unsigned)
+	{
+		size_t n = d.items.size(), k;
+		uint64_t sum = 0;
+
+		{
+			phase x(r[INSERT], n, mc);
+			for (obj * o : d.order)
+			{
+				std::lock_guard<std::mutex> g(lock);
+				stack.push_back(o);
+			}
+		}
+
+		{
+			phase x(r[POP], n, mc);
+			for (k = 0; k < n; )
+			{
+				std::lock_guard<std::mutex> g(lock);
+				if (stack.empty())
+					continue;
+
+				sum += stack.back()->payload, k++;
+				stack.pop_back();
+			}
+		}
+
+		d.sink = sum;
+	}
+};
+
+/*
+ *	Every thread adds, finds and erases its own items, in one map.
+ *	The erased items are retired, so this waits them out before
+ *	the items go away.
+ */
+struct shared_skiplist
+{
+	skip_map  map;
+
+	void run(data & d, results & r, const miss_counter & mc, unsigned, unsigned)
+	{
+		size_t n = d.items.size();
+		uint64_t sum = 0;
+
+		{ phase x(r[INSERT], n, mc); for (obj * o : d.order) map.add(&o->sk); }
+
+		{
+			phase x(r[FIND], n, mc);
+			ebr_guard g;
+
+			for (obj * o : d.lookup)
+				sum += container_of(map.find(o->key))->payload;
+		}
+
+		{ phase x(r[ERASE], n, mc); for (obj * o : d.lookup) map.del(&o->sk); }
+
+		ebr_synchronize();
+		d.sink = sum;
+	}
+};
+
+struct shared_std_map
+{
+	std::mutex                     lock;
+	std::multimap<uint64_t, obj*>  map;
+
+	void run(data & d, results & r, const miss_counter & mc, unsigned, unsigned)
+	{
+		size_t n = d.items.size();
+		uint64_t sum = 0;
+
+		{
+			phase x(r[INSERT], n, mc);
+			for (obj * o : d.order)
+			{
+				std::lock_guard<std::mutex> g(lock);
+				map.emplace(o->key, o);
+			}
+		}
+
+		{
+			phase x(r[FIND], n, mc);
+			for (obj * o : d.lookup)
+			{
+				std::lock_guard<std::mutex> g(lock);
+				sum += map.find(o->key)->second->payload;
+			}
+		}
+
+		{
+			phase x(r[ERASE], n, mc);
+			for (obj * o : d.lookup)
+			{
+				std::lock_guard<std::mutex> g(lock);
+				map.erase(map.find(o->key));
+			}
+		}
+
+		d.sink = sum;
+	}
+};
+
+/*
+ *	The driver
+ */
+typedef void (* test_fn)(data &, results &, const miss_counter &);
+
+struct test
+{
+	const char * name;
+	test_fn      fn;
+};
+
+static const test tests[] =
+{
+	{ "dlist_head",          test_dlist      },
+	{ "std::list<T*>",       test_std_list   },
+	{ "bi::list",            test_boost_list },
+	{ "hash_head",           test_hash       },
+	{ "std::unordered_map",  test_std_hash   },
+	{ "bi::unordered_set",   test_boost_hash },
+	{ "tree_head",           test_tree       },
+	{ "std::multimap",       test_std_tree   },
+	{ "bi::multiset",        test_boost_tree },
+	{ "heap_head",           test_heap       },
+	{ "std::priority_queue", test_std_heap   },
+	{ "lru_head",            test_lru        },
+	{ "list+unordered_map",  test_std_lru    },
+	{ "timer_wheel",         test_timers     },
+	{ "std::multimap<tick>", test_std_timers },
+};
+
+static void report(const char * name, const std::vector<results> & res, size_t n, unsigned threads)
+{
+	results total;
+	unsigned i;
+	int op;
+
+	for (i = 0; i < threads; i++)
+		for (op = 0; op < OPS; op++)
+			total[op] += res[i][op];
+
+	for (op = 0; op < OPS; op++)
+	{
+		const counters & c = total[op];
+		char misses[32] = "-";
+
+		if (! c.ops)
+			continue;
+
+		if (c.have_misses)
+			snprintf(misses, sizeof misses, "%.2f", (double)c.misses / c.ops);
+
+		printf("  %-20s %-9s %9zu %3u   %8.1f %8.2f %8s\n",
+		       name, op_name[op], n, threads, c.ns / c.ops, (double)c.allocs / c.ops, misses);
+	}
+}
+
+static void run(const test & t, size_t n, unsigned threads)
+{
+	std::vector<results> res(threads);
+	std::vector<std::thread> workers;
+	unsigned i;
+
+	/* each thread makes its own data, so it's in its local memory */
+	for (i = 0; i < threads; i++)
+		workers.emplace_back([&, i]{
+			miss_counter mc;
+			data d(n, i + 1);
+			t.fn(d, res[i], mc);
+		});
+
+	for (auto & w : workers)
+		w.join();
+
+	report(t.name, res, n, threads);
+}
+
+/*
+ *	Same, but with one container for all threads. The items may
+ *	end up with other threads, so no one's items go away until
+ *	all threads are done.
+ */
+template <typename S>
+static void run_shared(const char * name, size_t n, unsigned threads)
+{
+	std::vector<results> res(threads);
+	std::vector<std::thread> workers;
+	std::atomic<unsigned> done(0);
+	S s;
+	unsigned i;
+
+	for (i = 0; i < threads; i++)
+		workers.emplace_back([&, i]{
+			miss_counter mc;
+			data d(n, i + 1);
+			s.run(d, res[i], mc, i, threads);
+
+			done++;
+			while (done.load() < threads)
+				std::this_thread::yield();
+		});
+
+	for (auto & w : workers)
+		w.join();
+
+	report(name, res, n, threads);
+}
+
+struct shared_test
+{
+	const char * name;
+	void      (* fn)(const char *, size_t, unsigned);
+};
+
+static const shared_test shared_tests[] =
+{
+	{ "mpsc_head",           run_shared<shared_mpsc>      },
+	{ "mutex + std::deque",  run_shared<shared_std_queue> },
+	{ "stack_head",          run_shared<shared_stack>     },
+	{ "mutex + std::vector", run_shared<shared_std_stack> },
+	{ "skip_head",           run_shared<shared_skiplist>  },
+	{ "mutex + std::map",    run_shared<shared_std_map>   },
+};
+
+int main(int argc, char ** argv)
+{
+	size_t max_items  = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+	size_t per_thread = argc > 2 ? strtoul(argv[2], NULL, 10) : 100000;
+	unsigned cpus = std::thread::hardware_concurrency();
+	unsigned threads;
+	size_t n;
+
+	printf("  %-20s %-9s %9s %3s   %8s %8s %8s\n", "container", "op", "items", "thr", "ns/op", "allocs", "misses");
+
+	/* from L1-resident up */
+	for (n = 1000; n <= max_items; n *= 10)
+	{
+		for (const test & t : tests)
+			run(t, n, 1);
+		for (const shared_test & t : shared_tests)
+			t.fn(t.name, n, 1);
+		printf("\n");
+	}
+
+	for (threads = 2; threads <= cpus; threads *= 2)
+	{
+		for (const test & t : tests)
+			run(t, per_thread, threads);
+		for (const shared_test & t : shared_tests)
+			t.fn(t.name, per_thread, threads);
+		printf("\n");
+	}
+
+	return 0;
+}
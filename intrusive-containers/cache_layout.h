@@ -0,0 +1,96 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _CACHE_LAYOUT_H_
+#define _CACHE_LAYOUT_H_
+
+#include "linked_list.h"
+
+/*
+ *	Cache line size. 64 is right for x86 and for most of ARM,
+ *	but Apple's M-series chips have 128-byte lines.
+ */
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE  64
+#endif
+
+#define CACHE_ALIGNED  alignas(CACHE_LINE_SIZE)
+
+/*
+ *	Cache-aligned list items
+ *
+ *	These start a new cache line and they also make the holding
+ *	struct cache-aligned, which is what SAME_CACHE_LINE() needs.
+ *	The idea is to place the item first in a group of fields
+ *	that are read together with it when traversing the list:
+ *
+ *		struct foo
+ *		{
+ *			LIST_ITEM_ALIGNED  vip;      // hot - vip_list traversal
+ *			int                something;
+ *
+ *			char               cold[200];
+ *		};
+ *
+ *		SAME_CACHE_LINE(foo, vip, something);
+ */
+#define LIST_ITEM_ALIGNED          LIST_ITEM_ALIGNED_1(__LINE__)
+#define LIST_ITEM_ALIGNED_1(inst)  LIST_ITEM_ALIGNED_2(inst)
+#define LIST_ITEM_ALIGNED_2(inst)  struct list_inst_ ## inst { }; \
+                                   CACHE_ALIGNED list_item<list_inst_ ## inst>
+
+#define DLIST_ITEM_ALIGNED          DLIST_ITEM_ALIGNED_1(__LINE__)
+#define DLIST_ITEM_ALIGNED_1(inst)  DLIST_ITEM_ALIGNED_2(inst)
+#define DLIST_ITEM_ALIGNED_2(inst)  struct dlist_inst_ ## inst { }; \
+                                    CACHE_ALIGNED dlist_item<dlist_inst_ ## inst>
+
+/*
+ *	Compile-time layout checks
+ *
+ *	SAME_CACHE_LINE(T, a, b) asserts that fields 'a' and 'b' are
+ *	fully within the same cache line. This is only meaningful if
+ *	T is cache-aligned, so that's asserted too.
+ *
+ *	NO_FALSE_SHARING(T, a, b) asserts the opposite - that 'a' and
+ *	'b' don't share any cache lines. This is for items and heads
+ *	of containers that are used by different threads, e.g. for a
+ *	struct that is on a per-thread queue and on a shared list.
+ *	If T is not cache-aligned, its placement in memory is not
+ *	known, so the fields are required to be at least a line
+ *	apart. If T is aligned, they just need to be on different
+ *	lines.
+ */
+constexpr size_t cache_line_of(size_t offset)
+{
+	return offset / CACHE_LINE_SIZE;
+}
+
+constexpr bool same_cache_line(size_t a, size_t a_len, size_t b, size_t b_len)
+{
+	return cache_line_of(a) == cache_line_of(a + a_len - 1) &&
+	       cache_line_of(b) == cache_line_of(b + b_len - 1) &&
+	       cache_line_of(a) == cache_line_of(b);
+}
+
+constexpr bool apart_by_cache_line(size_t a, size_t a_len, size_t b, size_t b_len, size_t align)
+{
+	return (a > b) ? apart_by_cache_line(b, b_len, a, a_len, align) :
+	       (align >= CACHE_LINE_SIZE) ? cache_line_of(a + a_len - 1) < cache_line_of(b) :
+	                                    b >= a + a_len + CACHE_LINE_SIZE - 1;
+}
+
+#define SAME_CACHE_LINE(T, a, b)                                                  \
+	static_assert(alignof(T) >= CACHE_LINE_SIZE,                              \
+	              #T " is not cache-aligned");                                \
+	static_assert(same_cache_line(offsetof(T, a), sizeof(T::a),               \
+	                              offsetof(T, b), sizeof(T::b)),              \
+	              #T "::" #a " and " #T "::" #b " are on different cache lines")
+
+#define NO_FALSE_SHARING(T, a, b)                                                 \
+	static_assert(apart_by_cache_line(offsetof(T, a), sizeof(T::a),           \
+	                                  offsetof(T, b), sizeof(T::b),           \
+	                                  alignof(T)),                            \
+	              #T "::" #a " and " #T "::" #b " may share a cache line")
+
+#endif
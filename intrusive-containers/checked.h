@@ -0,0 +1,148 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _CHECKED_H_
+#define _CHECKED_H_
+
+/*
+ *	Checked mode
+ *
+ *	When INTRUSIVE_CHECKED is defined, list items record the head
+ *	of the list they are on and list heads keep a few counters.
+ *	This catches adding an item that is already on a list (incl.
+ *	another list of the same type, which compiles fine) and any
+ *	operations on items that are not on the list in question,
+ *	e.g. after they were removed from it.
+ *
+ *	The same goes for hash tables, trees and heaps, and for the
+ *	containers built on top of these and lists - LRU caches and
+ *	timer wheels. The lock-free containers are not checked.
+ *
+ *	The counters are in 'head.stats' -
+ *
+ *		length        current number of items
+ *		max_length    the largest it's been
+ *		inserts       total number of items added
+ *		removes       total number of items removed
+ *		steps         total number of range-for steps (lists only)
+ *
+ *	Without INTRUSIVE_CHECKED all this compiles to nothing, both
+ *	the checks and the extra fields.
+ *
+ *	On failure this calls INTRUSIVE_CHECK_FAILED(msg), which logs
+ *	and aborts by default.
+ */
+#ifdef INTRUSIVE_CHECKED
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef INTRUSIVE_CHECK_FAILED
+#define INTRUSIVE_CHECK_FAILED(msg)  (fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, msg), abort())
+#endif
+
+struct list_stats
+{
+	size_t  length;
+	size_t  max_length;
+	size_t  inserts;
+	size_t  removes;
+	size_t  steps;
+
+	list_stats() : length(0), max_length(0), inserts(0), removes(0), steps(0) { }
+};
+
+/*
+ *	The owner is stored the same way as the links, so that items
+ *	on relocatable lists still have it right after a move. 'L' is
+ *	the link type of the item this is expanded in.
+ */
+#define CHECKED_ITEM_FIELDS(L)                         \
+	typename L::template ptr<const void> owner = NULL;
+
+#define CHECKED_HEAD_FIELDS                            \
+	mutable list_stats stats;
+
+#define CHECK_ADD(head, item)                                                       \
+	do {                                                                        \
+		if ((item)->owner)                                                  \
+			INTRUSIVE_CHECK_FAILED((item)->owner == (head) ?            \
+			                       "item is already on this list" :     \
+			                       "item is already on another list");  \
+		(item)->owner = (head);                                             \
+		(head)->stats.inserts++;                                            \
+		if (++(head)->stats.length > (head)->stats.max_length)              \
+			(head)->stats.max_length = (head)->stats.length;            \
+	} while (0)
+
+#define CHECK_DEL(head, item)                                                       \
+	do {                                                                        \
+		CHECK_ON(head, item);                                               \
+		(item)->owner = NULL;                                               \
+		(head)->stats.removes++;                                            \
+		(head)->stats.length--;                                             \
+	} while (0)
+
+#define CHECK_ON(head, item)                                                        \
+	do {                                                                        \
+		if ((item)->owner != (head))                                        \
+			INTRUSIVE_CHECK_FAILED((item)->owner ?                      \
+			                       "item is on another list" :          \
+			                       "item is not on a list");            \
+	} while (0)
+
+/*
+ *	Preconditions of the bulk ops
+ */
+#define CHECK_EMPTY(head)                                                           \
+	do {                                                                        \
+		if ((head)->first)                                                  \
+			INTRUSIVE_CHECK_FAILED("list is not empty");                \
+	} while (0)
+
+#define CHECK_OTHER(head, other)                                                    \
+	do {                                                                        \
+		if ((head) == (other))                                              \
+			INTRUSIVE_CHECK_FAILED("both lists are the same");          \
+	} while (0)
+
+/*
+ *	Re-home a chain of items that ends either at 'last' or at NULL
+ */
+#define CHECK_MOVE(from, to, first, last)                                           \
+	do {                                                                        \
+		for (auto p_ = link_ptr(first); p_;                                 \
+		     p_ = (p_ == (last)) ? NULL : link_ptr(p_->next))               \
+		{                                                                   \
+			CHECK_DEL(from, p_);                                        \
+			CHECK_ADD(to, p_);                                          \
+		}                                                                   \
+	} while (0)
+
+#define CHECK_ADD_CHAIN(to, first, last)                                            \
+	do {                                                                        \
+		for (auto p_ = link_ptr(first); p_;                                 \
+		     p_ = (p_ == (last)) ? NULL : link_ptr(p_->next))               \
+			CHECK_ADD(to, p_);                                          \
+	} while (0)
+
+#define CHECK_STEP(stats)  ((stats)->steps++)
+
+#else
+
+#define CHECKED_ITEM_FIELDS(L)
+#define CHECKED_HEAD_FIELDS
+
+#define CHECK_ADD(head, item)              ((void)0)
+#define CHECK_DEL(head, item)              ((void)0)
+#define CHECK_ON(head, item)               ((void)0)
+#define CHECK_EMPTY(head)                  ((void)0)
+#define CHECK_OTHER(head, other)           ((void)0)
+#define CHECK_MOVE(from, to, first, last)  ((void)0)
+#define CHECK_ADD_CHAIN(to, first, last)   ((void)0)
+#define CHECK_STEP(stats)                  ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _CONTAINER_OF_H_
+#define _CONTAINER_OF_H_
+
+#include <stddef.h>
+#include <type_traits>
+
+/*
+ *	Template version of container_of, keyed by a member pointer
+ *
+ *		foo * p = container_of<&foo::vip>(item);
+ *
+ *	It needs no CONTAINER_OF() instantiation, so it can be used in
+ *	generic code that is given the field as a template argument,
+ *	e.g. list_sort<&foo::vip>() in list_sort.h.
+ *
+ *	For items nested in other structs give the path to it, from
+ *	the outermost struct in -
+ *
+ *		struct conn { stats st; ... };
+ *		struct stats { LIST_ITEM link; ... };
+ *
+ *		conn * c = container_of<&conn::st, &stats::link>(item);
+ *
+ *	For arrays of items also pass the index of the item -
+ *
+ *		struct bar { LIST_ITEM links[4]; ... };
+ *
+ *		bar * b = container_of<&bar::links>(item, 2);
+ *
+ *	Offsets can't be taken from member pointers in a constant
+ *	expression, so member_offset() is not constexpr. It's the old
+ *	offsetof() trick of taking the member's address off a NULL
+ *	pointer, which is formally UB, but it's what offsetof() was
+ *	for years and every compiler folds it into a constant. The
+ *	whole thing then compiles to a single subtract, same as the
+ *	macro version.
+ *
+ *	This needs C++17, for the 'auto' template arguments.
+ */
+template <typename P>
+struct member_of;
+
+template <typename T, typename M>
+struct member_of<M T::*>
+{
+	typedef T outer;
+	typedef M type;
+};
+
+template <auto F>
+inline size_t member_offset()
+{
+	typedef typename member_of<decltype(F)>::outer T;
+
+	return reinterpret_cast<size_t>( &(((T *)0)->*F) );
+}
+
+/*
+ *	The outermost struct, the innermost member, and the sum of
+ *	offsets along the way
+ */
+template <auto F, auto... Rest>
+struct member_path
+{
+	typedef typename member_of<decltype(F)>::outer   outer;
+	typedef typename member_path<Rest...>::member    member;
+
+	static_assert(std::is_same<typename member_of<decltype(F)>::type,
+	                           typename member_path<Rest...>::outer>::value,
+	              "each member must be of the type the next one is in");
+
+	static size_t offset() { return member_offset<F>() + member_path<Rest...>::offset(); }
+};
+
+template <auto F>
+struct member_path<F>
+{
+	typedef typename member_of<decltype(F)>::outer   outer;
+	typedef typename member_of<decltype(F)>::type    member;
+
+	static size_t offset() { return member_offset<F>(); }
+};
+
+template <typename M>
+struct array_of
+{
+	typedef M type;
+};
+
+template <typename M, size_t N>
+struct array_of<M[N]>
+{
+	typedef M type;
+};
+
+/*
+ *	The item is the field itself or, for arrays, the i'th element
+ *	of it
+ */
+template <auto... F>
+inline auto container_of(typename array_of<typename member_path<F...>::member>::type * item, size_t i = 0)
+	-> typename member_path<F...>::outer *
+{
+	typedef member_path<F...> path;
+
+	return (typename path::outer *)((char*)(item - i) - path::offset());
+}
+
+#endif
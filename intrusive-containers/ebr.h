@@ -0,0 +1,430 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _EBR_H_
+#define _EBR_H_
+
+#include "linked_list.h"    /* template_arg(), CONTAINER_OF() */
+
+#include <stdint.h>
+#include <atomic>
+#include <thread>
+
+/*
+ *	Epoch-based reclamation
+ *
+ *	Lock-free containers can't free an item as soon as it's removed,
+ *	because other threads may still be looking at it. With EBR the
+ *	threads wrap their container accesses into guards -
+ *
+ *		{
+ *			ebr_guard g;
+ *			p = map.find(k);
+ *			...
+ *		}
+ *
+ *	- and removed items are "retired" instead of being freed -
+ *
+ *		ebr_retire(&p->retire, free_foo);
+ *
+ *	There's a global epoch counter and each thread announces the
+ *	epoch it entered its guard at. The epoch is advanced when all
+ *	threads that are in guards have caught up with it. An item
+ *	retired at epoch E is only freed once the epoch is at E+2, at
+ *	which point no guard that could've seen the item is active.
+ *
+ *	Retired items are kept on per-thread lists, threaded through
+ *	an EBR_ITEM embedded into the item, so retiring allocates
+ *	nothing. They are freed in batches, every EBR_BATCH retires.
+ *
+ *	An item must be unlinked before it's retired, but retiring
+ *	doesn't need a guard. ebr_retire() fences before it reads the
+ *	epoch, so the unlink is visible to any guard that is entered
+ *	after that read and the item can't be seen from a later epoch.
+ *
+ *	Guards nest and they are cheap - entering is a store and a
+ *	fence, exiting is a store.
+ *
+ *	Threads that run a loop can also go "online" and then just
+ *	report a quiescent state once in a while, when they don't
+ *	hold any pointers into shared containers -
+ *
+ *		ebr_online();
+ *
+ *		while (...)
+ *		{
+ *			...              // no guards needed in here
+ *			ebr_quiescent();
+ *		}
+ *
+ *		ebr_offline();
+ *
+ *	This is QSBR, the read side is free and the writers wait for
+ *	all online threads to get to ebr_quiescent(). A thread should
+ *	go offline before blocking for long, or it will hold up the
+ *	freeing.
+ */
+#ifndef EBR_BATCH
+#define EBR_BATCH  64
+#endif
+
+struct ebr_node
+{
+	ebr_node * next;
+	void    (* invoke)(ebr_node *);
+};
+
+template <typename T>
+struct ebr_item
+{
+	ebr_node   node;    /* first, so the item is a cast away */
+	void    (* fn)(ebr_item *);
+
+	static void call(ebr_node * n)
+	{
+		ebr_item * e = (ebr_item *)n;
+		e->fn(e);
+	}
+};
+
+/*
+ *	Per-thread record
+ *
+ *	Records are put on a global list and never freed. When the
+ *	thread exits, its record is released for reuse along with
+ *	whatever items are still pending on it. These are marked as
+ *	orphaned and other threads free them as they retire their
+ *	own, see ebr_collect_orphans().
+ */
+struct ebr_record
+{
+	std::atomic<uint64_t>   state;      /* epoch << 1 | active    */
+	std::atomic<bool>       in_use;
+	std::atomic<bool>       orphaned;   /* released with items    */
+	ebr_record            * next;
+
+	unsigned                nesting;
+	bool                    online;     /* see ebr_online()       */
+	unsigned                retired;    /* since the last collect */
+
+	struct
+	{
+		uint64_t    epoch;
+		ebr_node  * first;
+	}
+	limbo[3];
+
+	ebr_record() : state(0), in_use(true), orphaned(false), next(NULL), nesting(0), online(false), retired(0)
+	{
+		for (auto & l : limbo) { l.epoch = 0; l.first = NULL; }
+	}
+};
+
+struct ebr_domain
+{
+	std::atomic<uint64_t>     epoch;
+	std::atomic<ebr_record *> records;
+
+	ebr_domain() : epoch(1), records(NULL) { }
+
+	ebr_record * acquire()
+	{
+		ebr_record * r;
+		bool expected;
+
+		for (r = records.load(std::memory_order_acquire); r; r = r->next)
+		{
+			expected = false;
+			if (r->in_use.compare_exchange_strong(expected, true))
+				return r;
+		}
+
+		r = new ebr_record;
+		r->next = records.load(std::memory_order_relaxed);
+		while (! records.compare_exchange_weak(r->next, r, std::memory_order_release,
+		                                                    std::memory_order_relaxed));
+		return r;
+	}
+
+	void release(ebr_record * r)
+	{
+		bool pending = false;
+
+		for (auto & l : r->limbo)
+			pending |= (l.first != NULL);
+
+		r->state.store(0, std::memory_order_release);
+		r->nesting = 0;
+		r->online = false;
+		r->orphaned.store(pending, std::memory_order_relaxed);
+		r->in_use.store(false, std::memory_order_release);
+	}
+
+	/*
+	 *	Advances the epoch if all active threads are in it
+	 */
+	bool try_advance()
+	{
+		uint64_t e = epoch.load(std::memory_order_acquire);
+		ebr_record * r;
+
+		/* pairs with the fence in ebr_guard(), so that either we
+		   see the thread as active or it sees what we unlinked */
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		for (r = records.load(std::memory_order_acquire); r; r = r->next)
+		{
+			uint64_t s = r->state.load(std::memory_order_acquire);
+
+			if ((s & 1) && (s >> 1) != e)
+				return false;
+		}
+
+		return epoch.compare_exchange_strong(e, e + 1, std::memory_order_acq_rel);
+	}
+};
+
+inline ebr_domain & ebr_global()
+{
+	static ebr_domain d;
+	return d;
+}
+
+/*
+ *	The calling thread's record
+ */
+struct ebr_thread
+{
+	ebr_record * rec;
+
+	ebr_thread() : rec(ebr_global().acquire()) { }
+	~ebr_thread() { ebr_global().release(rec); }
+};
+
+inline ebr_record * ebr_self()
+{
+	static thread_local ebr_thread self;
+	return self.rec;
+}
+
+/*
+ *	Frees items from the limbo lists that are at least 2 epochs
+ *	old
+ */
+inline void ebr_collect(ebr_record * r)
+{
+	uint64_t e = ebr_global().epoch.load(std::memory_order_acquire);
+
+	for (auto & l : r->limbo)
+	{
+		ebr_node * p, * n;
+
+		if (! l.first || l.epoch + 2 > e)
+			continue;
+
+		for (p = l.first; p; p = n)
+		{
+			n = p->next;
+			p->invoke(p);
+		}
+
+		l.first = NULL;
+	}
+
+	r->retired = 0;
+}
+
+/*
+ *	Frees what is left on the records of exited threads. These
+ *	are claimed the same way as when they are reused, so that
+ *	only one thread looks at a record at a time.
+ */
+inline void ebr_collect_orphans()
+{
+	ebr_domain & d = ebr_global();
+	ebr_record * r;
+	bool expected;
+
+	for (r = d.records.load(std::memory_order_acquire); r; r = r->next)
+	{
+		if (! r->orphaned.load(std::memory_order_relaxed))
+			continue;
+
+		expected = false;
+		if (! r->in_use.compare_exchange_strong(expected, true))
+			continue;
+
+		ebr_collect(r);
+		d.release(r);
+	}
+}
+
+inline void ebr_retire_node(ebr_node * n)
+{
+	ebr_record * r = ebr_self();
+	uint64_t e;
+
+	/* order the caller's unlink before the epoch read */
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	e = ebr_global().epoch.load(std::memory_order_acquire);
+	auto & l = r->limbo[e % 3];
+
+	/* the slot's previous contents are from e-3 or older */
+	if (l.epoch != e)
+	{
+		ebr_collect(r);
+		l.epoch = e;
+	}
+
+	n->next = l.first;
+	l.first = n;
+
+	if (++r->retired >= EBR_BATCH)
+	{
+		ebr_global().try_advance();
+		ebr_collect(r);
+		ebr_collect_orphans();
+	}
+}
+
+template <typename T>
+void ebr_retire(ebr_item<T> * e, void (* fn)(ebr_item<T> *))
+{
+	e->fn = fn;
+	e->node.invoke = &ebr_item<T>::call;
+	ebr_retire_node(&e->node);
+}
+
+/*
+ *	The default disposer for containers that retire items on
+ *	their own
+ */
+template <typename T>
+struct ebr_delete
+{
+	static void dispose(T * p) { delete p; }
+};
+
+/*
+ *	The guard
+ */
+struct ebr_guard
+{
+	ebr_record * rec;
+
+	ebr_guard() : rec(ebr_self())
+	{
+		if (rec->nesting++)
+			return;
+
+		rec->state.store(ebr_global().epoch.load(std::memory_order_relaxed) << 1 | 1,
+		                 std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+	}
+
+	~ebr_guard()
+	{
+		if (--rec->nesting)
+			return;
+
+		rec->state.store(0, std::memory_order_release);
+	}
+
+	ebr_guard(const ebr_guard &) = delete;
+	ebr_guard & operator = (const ebr_guard &) = delete;
+};
+
+/*
+ *	QSBR, see above. Guards taken by an online thread are just
+ *	a counter.
+ */
+inline void ebr_online()
+{
+	ebr_record * r = ebr_self();
+
+	r->online = true;
+
+	if (r->nesting++)
+		return;
+
+	r->state.store(ebr_global().epoch.load(std::memory_order_relaxed) << 1 | 1,
+	               std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+inline void ebr_offline()
+{
+	ebr_record * r = ebr_self();
+
+	r->online = false;
+
+	if (! --r->nesting)
+		r->state.store(0, std::memory_order_release);
+}
+
+inline void ebr_quiescent()
+{
+	ebr_record * r = ebr_self();
+
+	if (! r->online || r->nesting != 1)  /* not online or inside a guard */
+		return;
+
+	r->state.store(ebr_global().epoch.load(std::memory_order_relaxed) << 1 | 1,
+	               std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	if (r->retired)
+	{
+		ebr_global().try_advance();
+		ebr_collect(r);
+	}
+}
+
+/*
+ *	Waits until everything retired so far can be freed and frees
+ *	the calling thread's part of it. Other threads free theirs as
+ *	they go. For the writer side, e.g. before tearing down.
+ *
+ *	This must not be called from inside of a guard. For online
+ *	threads it's a quiescent point.
+ */
+inline void ebr_synchronize()
+{
+	ebr_record * r = ebr_self();
+	ebr_domain & d = ebr_global();
+	uint64_t target = d.epoch.load(std::memory_order_acquire) + 2;
+	uint64_t saved = r->state.load(std::memory_order_relaxed);
+
+	r->state.store(0, std::memory_order_release);
+
+	while (d.epoch.load(std::memory_order_acquire) < target)
+		if (! d.try_advance())
+			std::this_thread::yield();
+
+	if (saved)
+	{
+		r->state.store(d.epoch.load(std::memory_order_relaxed) << 1 | 1,
+		               std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+	}
+
+	ebr_collect(r);
+	ebr_collect_orphans();
+}
+
+/*
+ *	The boilerplate, same as for the lists
+ */
+#define EBR_ITEM          EBR_ITEM_1(__LINE__)
+#define EBR_ITEM_1(inst)  EBR_ITEM_2(inst)
+#define EBR_ITEM_2(inst)  struct ebr_inst_ ## inst { }; \
+                          ebr_item<ebr_inst_ ## inst>
+
+template <typename T>
+auto template_arg(ebr_item<T> &) -> T;
+
+#define EBR_ITEM_TYPE(T, field)  ebr_item<decltype(template_arg(T::field))>
+
+#endif
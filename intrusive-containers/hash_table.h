@@ -0,0 +1,362 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _HASH_TABLE_H_
+#define _HASH_TABLE_H_
+
+#include "linked_list.h"    /* template_arg(), CONTAINER_OF() */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <type_traits>
+
+/*
+ *	Hash table item
+ *
+ *	Buckets are chained the same way as Linux's hlist - 'pprev'
+ *	points at the previous item's 'next' or at the bucket slot,
+ *	so the item can be removed without knowing its bucket.
+ *
+ *	The hash of the key is cached in the item. Rehashing needs
+ *	it and it also saves on key comparisons during the lookup.
+ *
+ *	Same as with lists, the link type is the second template
+ *	argument, see offset_ptr.h.
+ */
+template <typename T, typename L = raw_links>
+struct hash_item
+{
+	typedef typename L::template ptr<hash_item> link;
+
+	link                            next;
+	typename L::template ptr<link>  pprev;
+	size_t                          hash;
+
+	CHECKED_ITEM_FIELDS(L)
+};
+
+/*
+ *	Key hashing
+ *
+ *	Integers, enums and pointers are run through a 64-bit mixer,
+ *	everything else is hashed as bytes with FNV-1a. The latter
+ *	is fine for packed PODs, but for keys with padding or with
+ *	indirect data specialize hash_of<> for the key type.
+ */
+inline size_t hash_mix(uint64_t x)
+{
+	x ^= x >> 33;
+	x *= 0xff51afd7ed558ccdULL;
+	x ^= x >> 33;
+	x *= 0xc4ceb9fe1a85ec53ULL;
+	x ^= x >> 33;
+	return (size_t)x;
+}
+
+inline size_t hash_bytes(const void * buf, size_t len)
+{
+	const uint8_t * p = (const uint8_t *)buf;
+	uint64_t h = 0xcbf29ce484222325ULL;
+
+	while (len--)
+		h = (h ^ *p++) * 0x100000001b3ULL;
+
+	return hash_mix(h);
+}
+
+template <typename K,
+          bool scalar = std::is_integral<K>::value ||
+                        std::is_enum<K>::value ||
+                        std::is_pointer<K>::value>
+struct hash_of
+{
+	static size_t get(const K & key) { return hash_bytes(&key, sizeof key); }
+};
+
+template <typename K>
+struct hash_of<K, true>
+{
+	static size_t get(const K & key) { return hash_mix((uint64_t)(uintptr_t)key); }
+};
+
+/*
+ *	Bucket allocator. Anything with these two will do, as long as
+ *	alloc() returns zeroed memory.
+ */
+struct hash_calloc
+{
+	static void * alloc(size_t n, size_t size) { return calloc(n, size); }
+	static void   free(void * p)               { ::free(p); }
+};
+
+/*
+ *	Hash table head
+ *
+ *	'I' is the item instance type, 'T' is the user struct and 'key'
+ *	is the T's field that the table is keyed by. Including the key
+ *	field into the type means that two tables linked through the
+ *	same item, but keyed differently won't mix either.
+ *
+ *	The bucket count is a power of two. The table starts with a
+ *	single bucket that is embedded into the head, so an empty
+ *	table needs no allocation. When the number of items exceeds
+ *	the number of buckets, a 2x bucket array is allocated and the
+ *	old buckets are moved over to it in slices of HASH_REHASH_STEP
+ *	per add(). While this is going on, the old buckets that are
+ *	not yet moved stay in use, so each key still maps to exactly
+ *	one bucket - see slot().
+ *
+ *	If the bucket array can't be allocated, the table just keeps
+ *	its size and gets slower. The items themselves are never
+ *	allocated or copied. Bucket arrays come from A.
+ *
+ *	Duplicate keys are allowed, find() returns the one that was
+ *	added last. Neither find() nor del() advance the rehashing,
+ *	so both are safe to use while iterating.
+ */
+#define HASH_REHASH_STEP  4
+
+template <typename I, typename T, typename K, K T::*key,
+          typename L = raw_links, typename A = hash_calloc>
+struct hash_head
+{
+	typedef hash_item<I, L>      item;
+	typedef typename item::link  link_t;   /* bucket */
+
+	typename L::template ptr<link_t>  bucket;     /* mask+1 buckets                 */
+	size_t                            mask;
+	typename L::template ptr<link_t>  old;        /* old buckets, while rehashing   */
+	size_t                            old_mask;
+	size_t                            old_pos;    /* first old bucket not yet moved */
+	size_t                            count;
+	link_t                            single;     /* initial/fallback single bucket */
+
+	CHECKED_HEAD_FIELDS
+
+	hash_head() : bucket(&single), mask(0), old(NULL), old_mask(0), old_pos(0), count(0), single(NULL) { }
+	~hash_head() { release(bucket); release(old); }
+
+	hash_head(const hash_head &) = delete;
+	hash_head & operator = (const hash_head &) = delete;
+
+	size_t size() const { return count; }
+	bool  empty() const { return ! count; }
+
+	static size_t hash_key(const K & k) { return hash_of<K>::get(k); }
+	static const K & key_of(item * it)  { return container_of(it)->*key; }
+
+	void add(item * it)
+	{
+		CHECK_ADD(this, it);
+		rehash_step();
+
+		if (count >= mask+1)
+			grow();
+
+		it->hash = hash_key( key_of(it) );
+		link(slot(it->hash), it);
+		count++;
+	}
+
+	void del(item * it)
+	{
+		CHECK_DEL(this, it);
+		unlink(it);
+		count--;
+	}
+
+	item * find(const K & k) const
+	{
+		size_t h = hash_key(k);
+		item * p;
+
+		for (p = *slot(h); p; p = p->next)
+			if (p->hash == h && key_of(p) == k)
+				return p;
+
+		return NULL;
+	}
+
+	/*
+	 *	Iteration, in no particular order -
+	 *
+	 *		for (auto p = table.first(); p; p = table.next(p))
+	 *			...
+	 *
+	 *	It's OK to del() the current item as long as next() is
+	 *	fetched before that, but adding items while iterating
+	 *	may cause some items to be skipped or visited twice.
+	 */
+	item * first() const
+	{
+		return scan(old ? old : bucket, old ? old_pos : 0);
+	}
+
+	item * next(item * it) const
+	{
+		size_t h = it->hash;
+
+		if (it->next)
+			return it->next;
+
+		if (old && (h & old_mask) >= old_pos)
+			return scan(old, (h & old_mask) + 1);
+
+		return scan(bucket, (h & mask) + 1);
+	}
+
+	/*
+	 *	Completes any pending rehashing in one go
+	 */
+	void rehash_all()
+	{
+		while (old)
+			rehash_step();
+	}
+
+	/*
+	 *	Internals
+	 */
+	const link_t * slot(size_t h) const
+	{
+		if (old && (h & old_mask) >= old_pos)
+			return link_ptr(old) + (h & old_mask);
+
+		return link_ptr(bucket) + (h & mask);
+	}
+
+	link_t * slot(size_t h)
+	{
+		return (link_t*)((const hash_head *)this)->slot(h);
+	}
+
+	static void link(link_t * head, item * it)
+	{
+		it->next = *head;
+		it->pprev = head;
+
+		if (*head) (*head)->pprev = &it->next;
+		*head = it;
+	}
+
+	static void unlink(item * it)
+	{
+		*it->pprev = it->next;
+		if (it->next) it->next->pprev = it->pprev;
+
+		it->next = NULL;
+		it->pprev = NULL;
+	}
+
+	item * scan(const link_t * table, size_t pos) const
+	{
+		/* the old table, then the new one */
+		if (table == old)
+		{
+			for ( ; pos <= old_mask; pos++)
+				if (old[pos]) return old[pos];
+
+			table = bucket;
+			pos = 0;
+		}
+
+		for ( ; pos <= mask; pos++)
+			if (bucket[pos]) return bucket[pos];
+
+		return NULL;
+	}
+
+	void grow()
+	{
+		link_t * fresh;
+
+		rehash_all();
+
+		fresh = (link_t*)A::alloc(2*(mask+1), sizeof(link_t));
+		if (! fresh)
+			return;
+
+		old = bucket;
+		old_mask = mask;
+		old_pos = 0;
+
+		bucket = fresh;
+		mask = 2*mask + 1;
+	}
+
+	void rehash_step()
+	{
+		size_t n;
+
+		if (! old)
+			return;
+
+		/*
+		 *	Old bucket 'i' splits into new 'i' and 'i + old_mask + 1',
+		 *	which are both still empty. Items are appended to them to
+		 *	keep the order of duplicates, so that find() still gets
+		 *	the last added one.
+		 */
+		for (n = 0; n < HASH_REHASH_STEP && old_pos <= old_mask; n++, old_pos++)
+		{
+			link_t * tail[2] = { link_ptr(bucket) + old_pos, link_ptr(bucket) + old_pos + old_mask + 1 };
+			item * p, * q;
+
+			for (p = old[old_pos]; p; p = q)
+			{
+				link_t * & t = tail[ (p->hash & mask) != old_pos ];
+
+				q = p->next;
+				p->next = NULL;
+				p->pprev = t;
+				*t = p;
+				t = &p->next;
+			}
+
+			old[old_pos] = NULL;
+		}
+
+		if (old_pos > old_mask)
+		{
+			release(old);
+			old = NULL;
+			old_mask = 0;
+			old_pos = 0;
+		}
+	}
+
+	void release(link_t * table)
+	{
+		if (table && table != &single)
+			A::free(table);
+	}
+};
+
+/*
+ *	The boilerplate, same as for the lists
+ */
+#define HASH_ITEM          HASH_ITEM_1(__LINE__)
+#define HASH_ITEM_1(inst)  HASH_ITEM_2(inst)
+#define HASH_ITEM_2(inst)  struct hash_inst_ ## inst { }; \
+                           hash_item<hash_inst_ ## inst>
+
+template <typename T, typename L>
+auto template_arg(hash_item<T, L> &) -> T;
+
+template <typename T, typename L>
+auto links_arg(hash_item<T, L> &) -> L;
+
+#define HASH_HEAD_TYPE(T, field, key_field, ...)                              \
+	hash_head<decltype(template_arg(T::field)), T,                        \
+	          decltype(T::key_field), &T::key_field,                      \
+	          decltype(links_arg(T::field)), ##__VA_ARGS__>
+
+#define HASH_ITEM_TYPE(T, field)  hash_item<decltype(template_arg(T::field)), decltype(links_arg(T::field))>
+
+/*
+ *	HASH_HEAD(T, field, key_field [, allocator])
+ */
+#define HASH_HEAD(T, field, key_field, ...)  HASH_HEAD_TYPE(T, field, key_field, ##__VA_ARGS__)
+
+#endif
@@ -0,0 +1,117 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ *
+ *	g++ -std=c++11 hash_table_example.cpp
+ */
+#include "hash_table.h"
+#include <assert.h>
+
+struct session
+{
+	int  id;
+	int  port;
+
+	HASH_ITEM  by_id;
+	HASH_ITEM  by_port;
+};
+
+CONTAINER_OF(session, by_id);
+CONTAINER_OF(session, by_port);
+
+/*
+ *	600 items, so that the table is half-way through growing from
+ *	512 to 1024 buckets when they are all in
+ */
+#define N      600
+#define PORTS  10
+
+static session  s[N];
+
+void test()
+{
+	HASH_HEAD(session, by_id,   id)    ids;
+	HASH_HEAD(session, by_port, port)  ports;
+
+	HASH_ITEM_TYPE(session, by_id) * p, * n;
+	int  i, k;
+
+	/*
+	 *	compile-time checks
+	 */
+	ids.add(&s[0].by_id);      // these will compile ...
+	ports.add(&s[0].by_port);
+
+//	ids.add(&s[0].by_port);    // ... and these will not
+//	ports.add(&s[0].by_id);
+
+	ids.del(&s[0].by_id);
+	ports.del(&s[0].by_port);
+
+	/*
+	 *	duplicate keys, find() gets the last one added, including
+	 *	while the table is being rehashed
+	 */
+	for (i = 0; i < N; i++)
+	{
+		s[i].id = i;
+		s[i].port = i % PORTS;
+
+		ids.add(&s[i].by_id);
+		ports.add(&s[i].by_port);
+
+		assert(container_of(ports.find(s[i].port)) == &s[i]);
+	}
+
+	assert(ports.old);
+	assert(ports.size() == N);
+
+	/*
+	 *	removing them one by one gives them back in reverse, from
+	 *	the old and new buckets alike ...
+	 */
+	for (i = N - PORTS + 3; i >= 0; i -= PORTS)
+	{
+		assert(container_of(ports.find(3)) == &s[i]);
+		ports.del(&s[i].by_port);
+	}
+
+	assert(! ports.find(3));
+	assert(ports.old);
+
+	/*
+	 *	... and after the rehashing is done too
+	 */
+	ports.rehash_all();
+	assert(! ports.old);
+
+	for (i = N - PORTS + 7; i >= 0; i -= PORTS)
+	{
+		assert(container_of(ports.find(7)) == &s[i]);
+		ports.del(&s[i].by_port);
+	}
+
+	/*
+	 *	iteration visits every item once, and it's OK to remove
+	 *	the current one
+	 */
+	for (k = 0, p = ids.first(); p; p = n)
+	{
+		n = ids.next(p);
+		if (container_of(p)->id & 1)
+			ids.del(p);
+		k++;
+	}
+
+	assert(k == N);
+	assert(ids.size() == N / 2);
+
+	for (i = 0; i < N; i++)
+		assert(ids.find(i) == ((i & 1) ? NULL : &s[i].by_id));
+}
+
+int main()
+{
+	test();
+	return 0;
+}
@@ -6,25 +6,423 @@
 #define _LINKED_LIST_H_
 
 #include <stddef.h>
+#include <atomic>
+
+#include "checked.h"
+
+/*
+ *	Link types
+ *
+ *	Items and heads store their links as L::ptr<>, which is either
+ *	a plain pointer or an offset_ptr, which makes lists relocatable.
+ *	See offset_ptr.h for details. link_ptr() gives the plain pointer
+ *	for either. L::atomic_ptr<> is the same for the MPSC queue.
+ */
+struct raw_links
+{
+	template <typename X> using ptr = X *;
+	template <typename X> using atomic_ptr = std::atomic<X *>;
+};
+
+template <typename X>
+X * link_ptr(X * p) { return p; }
 
 /* 
  *	Linked list item
  */
-template <typename T, int inst>
+template <typename T, typename L = raw_links>
 struct list_item
 {
-	list_item * next;
+	typename L::template ptr<list_item> next;
+
+	CHECKED_ITEM_FIELDS(L)
+};
+
+/*
+ *	Range-for iterator, for both list types
+ *
+ *		for (foo * p : vip_list)
+ *			p->something++;
+ *
+ *	It yields the user struct rather than the item, so it needs
+ *	CONTAINER_OF() for the field to be declared before the loop.
+ *	The 'next' is fetched before the loop body is run, so it's
+ *	OK to remove the current item from the list in the body.
+ */
+template <typename I>
+struct list_iter
+{
+	I * p;
+	I * n;
+
+#ifdef INTRUSIVE_CHECKED
+	list_stats * stats;
+
+	list_iter(I * first, list_stats * s = NULL) : p(first), n(first ? link_ptr(first->next) : NULL), stats(s) { }
+#else
+	list_iter(I * first) : p(first), n(first ? link_ptr(first->next) : NULL) { }
+#endif
+
+	auto operator * () const -> decltype(container_of((I*)0)) { return container_of(p); }
+
+	list_iter & operator ++ ()
+	{
+		CHECK_STEP(stats);
+		p = n;
+		n = p ? link_ptr(p->next) : NULL;
+		return *this;
+	}
+
+	bool operator != (const list_iter & other) const { return p != other.p; }
 };
 
 /*
  *	Linked list head
  */
-template <typename T, int inst>
+template <typename T, typename L = raw_links>
 struct list_head
 {
-	list_item<T, inst> * first;
+	typedef list_item<T, L> item_type;
+
+	typename L::template ptr<item_type> first;
+
+	CHECKED_HEAD_FIELDS
+
+	list_head() : first(NULL) { }
+
+	void add(item_type * item)
+	{
+		CHECK_ADD(this, item);
+
+		item->next = first;
+		first = item;
+	}
+
+	item_type * pop()
+	{
+		item_type * item = first;
+
+		if (item)
+		{
+			CHECK_DEL(this, item);
+			first = item->next;
+		}
+
+		return item;
+	}
+
+	/*
+	 *	Bulk ops
+	 *
+	 *	The list has no tail pointer, so adding is at the front and
+	 *	splice() needs to walk 'other' to find its end.
+	 */
+	void add_chain(item_type * chain_first, item_type * chain_last)
+	{
+		CHECK_ADD_CHAIN(this, chain_first, chain_last);
+
+		chain_last->next = first;
+		first = chain_first;
+	}
+
+	void splice(list_head & other)  /* moves 'other' to the front */
+	{
+		item_type * p;
+
+		if (! other.first)
+			return;
+
+		for (p = other.first; p->next; p = p->next);
+
+		CHECK_MOVE(&other, this, other.first, p);
+
+		p->next = first;
+		first = other.first;
+		other.first = NULL;
+	}
+
+	/*
+	 *	Moves everything after 'item' into 'rest', which must be
+	 *	empty. If 'item' is NULL, moves the whole list.
+	 */
+	void cut_at(item_type * item, list_head & rest)
+	{
+		typename L::template ptr<item_type> * link = item ? &item->next : &first;
+
+		CHECK_EMPTY(&rest);
+		if (item) CHECK_ON(this, item);
+		CHECK_MOVE(this, &rest, *link, NULL);
+
+		rest.first = *link;
+		*link = NULL;
+	}
+
+	/*
+	 *	Moves items for which pred(container_of(item)) is true to
+	 *	the front of 'out', keeping their order. The rest keep
+	 *	their order too. 'out' must be a different list.
+	 */
+	template <typename F>
+	void partition(F pred, list_head & out)
+	{
+		typename L::template ptr<item_type> * link = &first;
+		item_type * moved = NULL, * moved_last = NULL;
+		item_type * p;
+
+		CHECK_OTHER(this, &out);
+
+		while ((p = *link))
+		{
+			if (! pred(container_of(p)))
+			{
+				link = &p->next;
+				continue;
+			}
+
+			CHECK_DEL(this, p);
+			*link = p->next;
+
+			if (moved_last) moved_last->next = p;
+			else            moved = p;
+
+			moved_last = p;
+		}
+
+		if (moved)
+			out.add_chain(moved, moved_last);
+	}
+
+#ifdef INTRUSIVE_CHECKED
+	list_iter<item_type> begin() const { return list_iter<item_type>(first, &stats); }
+#else
+	list_iter<item_type> begin() const { return list_iter<item_type>(first); }
+#endif
+	list_iter<item_type> end()   const { return NULL; }
+};
+
+/*
+ *	Doubly-linked list item
+ */
+template <typename T, typename L = raw_links>
+struct dlist_item
+{
+	typename L::template ptr<dlist_item> next;
+	typename L::template ptr<dlist_item> prev;
+
+	CHECKED_ITEM_FIELDS(L)
+};
+
+/*
+ *	Doubly-linked list head
+ *
+ *	The list is NULL-terminated at both ends, so it's traversed
+ *	the same way as the singly-linked one. Removal is O(1), but
+ *	needs the head, because it may need to update 'first' and
+ *	'last'.
+ */
+template <typename T, typename L = raw_links>
+struct dlist_head
+{
+	typedef dlist_item<T, L> item_type;
+
+	typename L::template ptr<item_type> first;
+	typename L::template ptr<item_type> last;
+
+	CHECKED_HEAD_FIELDS
+
+	dlist_head() : first(NULL), last(NULL) { }
+
+	bool empty() const { return ! first; }
+
+	void add_head(item_type * item)
+	{
+		CHECK_ADD(this, item);
+
+		item->prev = NULL;
+		item->next = first;
+
+		if (first) first->prev = item;
+		else       last = item;
+
+		first = item;
+	}
+
+	void add_tail(item_type * item)
+	{
+		CHECK_ADD(this, item);
+
+		item->next = NULL;
+		item->prev = last;
+
+		if (last) last->next = item;
+		else      first = item;
+
+		last = item;
+	}
+
+	void add(item_type * item) { add_head(item); }
+
+	void insert_before(item_type * pos, item_type * item)
+	{
+		CHECK_ON(this, pos);
+		CHECK_ADD(this, item);
+
+		item->next = pos;
+		item->prev = pos->prev;
+
+		if (pos->prev) pos->prev->next = item;
+		else           first = item;
+
+		pos->prev = item;
+	}
+
+	void insert_after(item_type * pos, item_type * item)
+	{
+		CHECK_ON(this, pos);
+		CHECK_ADD(this, item);
+
+		item->prev = pos;
+		item->next = pos->next;
+
+		if (pos->next) pos->next->prev = item;
+		else           last = item;
+
+		pos->next = item;
+	}
+
+	void del(item_type * item)
+	{
+		CHECK_DEL(this, item);
+
+		if (item->prev) item->prev->next = item->next;
+		else            first = item->next;
+
+		if (item->next) item->next->prev = item->prev;
+		else            last = item->prev;
+
+		item->next = item->prev = NULL;
+	}
+
+	/*
+	 *	Bulk ops, all O(1) except for partition()
+	 */
+
+	/*
+	 *	Adds a chain of items, already linked through both 'next'
+	 *	and 'prev', to the end of the list
+	 */
+	void add_chain(item_type * chain_first, item_type * chain_last)
+	{
+		CHECK_ADD_CHAIN(this, chain_first, chain_last);
+		link_chain(chain_first, chain_last);
+	}
 
-	void add(list_item<T, inst> * item) { /* implement me */ }
+	/*
+	 *	Moves all items of 'other' to the end of this list
+	 */
+	void splice(dlist_head & other)
+	{
+		if (! other.first)
+			return;
+
+		CHECK_MOVE(&other, this, other.first, other.last);
+
+		link_chain(other.first, other.last);
+		other.first = other.last = NULL;
+	}
+
+	/*
+	 *	Moves all items of 'other' in front of 'pos', or to the
+	 *	end if 'pos' is NULL
+	 */
+	void splice_before(item_type * pos, dlist_head & other)
+	{
+		if (! other.first)
+			return;
+
+		if (! pos)
+			return splice(other);
+
+		CHECK_ON(this, pos);
+		CHECK_MOVE(&other, this, other.first, other.last);
+
+		other.first->prev = pos->prev;
+		other.last->next = pos;
+
+		if (pos->prev) pos->prev->next = other.first;
+		else           first = other.first;
+
+		pos->prev = other.last;
+		other.first = other.last = NULL;
+	}
+
+	/*
+	 *	Moves everything after 'item' to 'rest', which must be
+	 *	empty. If 'item' is NULL, moves the whole list.
+	 */
+	void cut_at(item_type * item, dlist_head & rest)
+	{
+		item_type * p = item ? item->next : first;
+
+		CHECK_EMPTY(&rest);
+		if (item) CHECK_ON(this, item);
+
+		if (! p)
+			return;
+
+		CHECK_MOVE(this, &rest, p, NULL);
+
+		rest.first = p;
+		rest.last = last;
+		p->prev = NULL;
+
+		last = item;
+		if (item) item->next = NULL;
+		else      first = NULL;
+	}
+
+	/*
+	 *	Moves items for which pred(container_of(item)) is true to
+	 *	the end of 'out', keeping their order. The rest keep their
+	 *	order too. 'out' must be a different list, or this would
+	 *	never finish.
+	 */
+	template <typename F>
+	void partition(F pred, dlist_head & out)
+	{
+		item_type * p, * n;
+
+		CHECK_OTHER(this, &out);
+
+		for (p = first; p; p = n)
+		{
+			n = p->next;
+
+			if (pred(container_of(p)))
+			{
+				del(p);
+				out.add_tail(p);
+			}
+		}
+	}
+
+	void link_chain(item_type * chain_first, item_type * chain_last)
+	{
+		chain_first->prev = last;
+		chain_last->next = NULL;
+
+		if (last) last->next = chain_first;
+		else      first = chain_first;
+
+		last = chain_last;
+	}
+
+#ifdef INTRUSIVE_CHECKED
+	list_iter<item_type> begin() const { return list_iter<item_type>(first, &stats); }
+#else
+	list_iter<item_type> begin() const { return list_iter<item_type>(first); }
+#endif
+	list_iter<item_type> end()   const { return NULL; }
 };
 
 /*
@@ -38,20 +436,38 @@ struct list_head
 #define LIST_ITEM_2(inst)  struct list_inst_ ## inst { }; \
                            list_item<list_inst_ ## inst>
 
+#define DLIST_ITEM          DLIST_ITEM_1(__LINE__)
+#define DLIST_ITEM_1(inst)  DLIST_ITEM_2(inst)
+#define DLIST_ITEM_2(inst)  struct dlist_inst_ ## inst { }; \
+                            dlist_item<dlist_inst_ ## inst>
+
 /*
  *	2. To recover 'item' and 'head' types from a struct (T) that 
  *	   contains the head of a container as its [field]
  */
-template <typename T>
-auto template_arg(list_item<T> &) -> T;
+template <typename T, typename L>
+auto template_arg(list_item<T, L> &) -> T;
+
+template <typename T, typename L>
+auto template_arg(dlist_item<T, L> &) -> T;
+
+template <typename T, typename L>
+auto links_arg(list_item<T, L> &) -> L;
+
+template <typename T, typename L>
+auto links_arg(dlist_item<T, L> &) -> L;
+
+#define LIST_HEAD_TYPE(T, field)  list_head<decltype(template_arg(T::field)), decltype(links_arg(T::field))>
+#define LIST_ITEM_TYPE(T, field)  list_item<decltype(template_arg(T::field)), decltype(links_arg(T::field))>
 
-#define LIST_HEAD_TYPE(T, field)  list_head<decltype(template_arg(T::field))>
-#define LIST_ITEM_TYPE(T, field)  list_item<decltype(template_arg(T::field))>
+#define DLIST_HEAD_TYPE(T, field)  dlist_head<decltype(template_arg(T::field)), decltype(links_arg(T::field))>
+#define DLIST_ITEM_TYPE(T, field)  dlist_item<decltype(template_arg(T::field)), decltype(links_arg(T::field))>
 
 /*
  *	3. Shorthand for LIST_HEAD, for consistency with LIST_ITEM
  */
-#define LIST_HEAD(T, field)  LIST_HEAD_TYPE(T, field)
+#define LIST_HEAD(T, field)   LIST_HEAD_TYPE(T, field)
+#define DLIST_HEAD(T, field)  DLIST_HEAD_TYPE(T, field)
 
 /*
  *	Finally, CONTAINER_OF() - a boilerplate macro that needs to
@@ -61,7 +477,7 @@ auto template_arg(list_item<T> &) -> T;
 #define CONTAINER_OF(T, field)                                      \
 	inline T * container_of(decltype(T::field) * item)          \
 	{                                                           \
-		return (T*)((char*)item - (int)offsetof(T, field)); \
+		return (T*)((char*)item - offsetof(T, field));      \
 	}
 
 #endif
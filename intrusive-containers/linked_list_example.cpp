@@ -3,7 +3,9 @@
  *	https://github.com/apankrat/notes/blob/master/intrusive-containers
  */
 #include "linked_list.h"
+#include "offset_ptr.h"
 #include <assert.h>
+#include <string.h>
 
 struct foo
 {
@@ -51,3 +53,45 @@ void test()
 	p = container_of(&b.hip);
 	assert(p == &b);
 }
+
+/*
+ *	relocatable lists
+ */
+struct bar
+{
+	int  something;
+
+	DLIST_ITEM_OFFSET  dof;
+};
+
+CONTAINER_OF(bar, dof);
+
+struct arena
+{
+	DLIST_HEAD(bar, dof)  list;
+	bar                   items[4];
+};
+
+void test_relocation()
+{
+	static arena  a, b;
+	int  i;
+
+	for (i = 0; i < 4; i++)
+		a.list.add_tail(&a.items[i].dof);
+
+	/*
+	 *	move the whole thing, the list now links b.items
+	 */
+	memcpy((void*)&b, (void*)&a, sizeof a);
+
+	for (bar * q : b.list)
+		assert(q >= b.items && q < b.items + 4);
+
+	/*
+	 *	items still know their list, incl. in checked mode
+	 */
+	b.list.del(&b.items[2].dof);
+	b.list.add_head(&b.items[2].dof);
+	assert(container_of(link_ptr(b.list.first)) == &b.items[2]);
+}
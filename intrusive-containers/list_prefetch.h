@@ -0,0 +1,117 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _LIST_PREFETCH_H_
+#define _LIST_PREFETCH_H_
+
+#include "linked_list.h"
+
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define PREFETCH(addr)  _mm_prefetch((const char *)(addr), _MM_HINT_T0)
+#else
+#define PREFETCH(addr)  __builtin_prefetch(addr)
+#endif
+
+/*
+ *	Prefetching range-for traversal
+ *
+ *		for (foo * p : prefetched(vip_list, 8))
+ *			...
+ *
+ *		for (foo * p : prefetched(vip_list, 8, &foo::something))
+ *			...
+ *
+ *	This walks a second pointer 'distance' items ahead of the
+ *	current one. At every step it prefetches the item after the
+ *	look-ahead one (i.e. the "next->next") and, if a hot field
+ *	is given, that field of the look-ahead's struct.
+ *
+ *	Note that this can't unchain the pointer chasing itself - to
+ *	have the address of an item, the one before it needs to be
+ *	loaded first. What it does is keep the list walk ahead of the
+ *	loop body, so the misses on the payload overlap with those of
+ *	the walk instead of adding to them. The gain is therefore the
+ *	largest when the loop reads fields that are on a different
+ *	cache line from the item - see cache_layout.h for avoiding
+ *	that in the first place.
+ */
+template <typename I, typename M>
+struct prefetch_iter
+{
+	I * p;
+	I * n;
+	I * ahead;
+	M   hot;
+
+	prefetch_iter(I * first, int distance, M hot_) : p(first), n(first ? link_ptr(first->next) : NULL), ahead(first), hot(hot_)
+	{
+		while (ahead && distance-- > 0)
+			step();
+	}
+
+	auto operator * () const -> decltype(container_of((I*)0)) { return container_of(p); }
+
+	prefetch_iter & operator ++ ()
+	{
+		p = n;
+		n = p ? link_ptr(p->next) : NULL;
+
+		if (ahead)
+			step();
+
+		return *this;
+	}
+
+	bool operator != (const prefetch_iter & other) const { return p != other.p; }
+
+	void step()
+	{
+		ahead = link_ptr(ahead->next);
+		if (! ahead)
+			return;
+
+		if (ahead->next)
+			PREFETCH(link_ptr(ahead->next));
+
+		touch(hot);
+	}
+
+	void touch(decltype(nullptr)) { }
+
+	template <typename F>
+	void touch(F field)
+	{
+		PREFETCH( &(container_of(ahead)->*field) );
+	}
+};
+
+template <typename I, typename M>
+struct prefetch_range
+{
+	I  * first;
+	int  distance;
+	M    hot;
+
+	prefetch_iter<I, M> begin() const { return prefetch_iter<I, M>(first, distance, hot); }
+	prefetch_iter<I, M> end()   const { return prefetch_iter<I, M>(NULL, 0, hot); }
+};
+
+template <typename L>
+auto prefetched(const L & list, int distance)
+	-> prefetch_range<typename std::remove_pointer<decltype(link_ptr(list.first))>::type, decltype(nullptr)>
+{
+	return { link_ptr(list.first), distance, nullptr };
+}
+
+template <typename L, typename T, typename F>
+auto prefetched(const L & list, int distance, F T::*hot)
+	-> prefetch_range<typename std::remove_pointer<decltype(link_ptr(list.first))>::type, F T::*>
+{
+	return { link_ptr(list.first), distance, hot };
+}
+
+#endif
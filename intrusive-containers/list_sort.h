@@ -0,0 +1,303 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _LIST_SORT_H_
+#define _LIST_SORT_H_
+
+#include "linked_list.h"
+
+#if __cplusplus >= 201703L
+#include "container_of.h"
+#endif
+
+#include <thread>
+
+/*
+ *	Merge sort for both list types
+ *
+ *		list_sort(tasks, [](const task * a, const task * b){ return a->deadline < b->deadline; });
+ *
+ *	The comparator gets the user structs. The sort is stable and
+ *	it doesn't allocate - it just relinks the items.
+ *
+ *	It's bottom-up and starts by splitting the list into natural
+ *	runs, which is a single sequential pass. Ascending runs are
+ *	taken as is, strictly descending ones are reversed and short
+ *	ones are topped up to LIST_SORT_MIN_RUN with insertion. The runs
+ *	are then merged with a binary counter, in the same way as
+ *	std::list::sort does it, so runs of similar size get merged
+ *	while they are still warm in the cache. Sorted and reverse
+ *	sorted lists take a single pass.
+ *
+ *	list_sort_parallel() splits the list into equal parts, sorts
+ *	them on separate threads and then merges them pairwise, also
+ *	in parallel. It helps with lists that are much larger than
+ *	the cache. Shorter ones are sorted serially.
+ *
+ *	With C++17 both can also be given the field instead of relying
+ *	on CONTAINER_OF(), which is handy in generic code -
+ *
+ *		list_sort<&task::by_deadline>(tasks, ...);
+ */
+#define LIST_SORT_BINS      64
+#define LIST_SORT_MIN_RUN   8
+#define LIST_SORT_PARALLEL  (64*1024)   /* min items per thread */
+
+/*
+ *	Internals, these work on NULL-terminated 'next' chains and
+ *	'less' compares the items
+ */
+template <typename I, typename F>
+I * sort_merge(I * a, I * b, F & less)
+{
+	I * first, * last;
+
+	if (! a || ! b)
+		return a ? a : b;
+
+	if (less(b, a)) first = b, b = b->next;
+	else            first = a, a = a->next;
+
+	for (last = first; a && b; last = last->next)
+	{
+		if (less(b, a)) last->next = b, b = b->next;
+		else            last->next = a, a = a->next;
+	}
+
+	last->next = a ? a : b;
+	return first;
+}
+
+template <typename I, typename F>
+I * sort_chain(I * p, F & less)
+{
+	I * bin[LIST_SORT_BINS] = { };
+	I * run, * last, * n, * q;
+	size_t len;
+	int k;
+
+	while (p)
+	{
+		n = p->next;
+
+		if (n && less(n, p))
+		{
+			/* strictly descending, reverse it */
+			run = last = p;
+			run->next = NULL;
+
+			for (p = n; p && less(p, run); p = n)
+			{
+				n = p->next;
+				p->next = run;
+				run = p;
+			}
+		}
+		else
+		{
+			for (run = last = p; n && ! less(n, last); n = n->next)
+				last = n;
+
+			last->next = NULL;
+			p = n;
+		}
+
+		/* extend short runs to LIST_SORT_MIN_RUN with insertion sort */
+		for (len = 1, q = run; q != last; q = q->next)
+			len++;
+
+		for ( ; p && len < LIST_SORT_MIN_RUN; len++, p = n)
+		{
+			n = p->next;
+
+			if (less(p, run))
+			{
+				p->next = run;
+				run = p;
+				continue;
+			}
+
+			for (q = run; q->next && ! less(p, q->next); q = q->next);
+
+			p->next = q->next;
+			q->next = p;
+		}
+
+		/* bin[k] holds 2^k runs, all of them before 'run' */
+		for (k = 0; bin[k]; k++)
+		{
+			run = sort_merge(bin[k], run, less);
+			bin[k] = NULL;
+		}
+
+		bin[k] = run;
+	}
+
+	for (run = NULL, k = 0; k < LIST_SORT_BINS; k++)
+		if (bin[k])
+			run = sort_merge(bin[k], run, less);
+
+	return run;
+}
+
+template <typename I, typename F>
+I * sort_chain_parallel(I * p, F & less, unsigned threads)
+{
+	I * part[64];
+	std::thread worker[64];
+	size_t n, per, i;
+	unsigned k, step;
+	I * q;
+
+	for (n = 0, q = p; q; q = q->next)
+		n++;
+
+	if (threads > 64)
+		threads = 64;
+
+	if (threads > n / LIST_SORT_PARALLEL)
+		threads = (unsigned)(n / LIST_SORT_PARALLEL);
+
+	if (threads < 2)
+		return sort_chain(p, less);
+
+	/* split */
+	per = (n + threads - 1) / threads;
+
+	for (k = 0; k < threads && p; k++)
+	{
+		part[k] = p;
+
+		for (i = 1; i < per && p->next; i++)
+			p = p->next;
+
+		q = p->next;
+		p->next = NULL;
+		p = q;
+	}
+
+	threads = k;
+
+	/* sort */
+	for (k = 1; k < threads; k++)
+		worker[k] = std::thread([&part, &less, k]{ part[k] = sort_chain(part[k], less); });
+
+	part[0] = sort_chain(part[0], less);
+
+	for (k = 1; k < threads; k++)
+		worker[k].join();
+
+	/* merge, keeping the parts in order for stability */
+	for (step = 1; step < threads; step *= 2)
+	{
+		for (k = 0; k + step < threads; k += 2*step)
+			worker[k] = std::thread([&part, &less, k, step]{ part[k] = sort_merge(part[k], part[k+step], less); });
+
+		for (k = 0; k + step < threads; k += 2*step)
+			worker[k].join();
+	}
+
+	return part[0];
+}
+
+template <typename T, typename L>
+void sort_relink(dlist_head<T, L> & list, dlist_item<T, L> * first)
+{
+	dlist_item<T, L> * p, * prev = NULL;
+
+	for (p = first; p; prev = p, p = p->next)
+		p->prev = prev;
+
+	list.first = first;
+	list.last = prev;
+}
+
+/*
+ *	The comparator for the internals, this turns items into T's
+ */
+template <typename I, typename F>
+struct sort_by_item
+{
+	F & less;
+
+	bool operator() (I * a, I * b) const { return less(container_of(a), container_of(b)); }
+};
+
+/*
+ *	The API
+ */
+template <typename T, typename L, typename F>
+void list_sort(list_head<T, L> & list, F less)
+{
+	sort_by_item<list_item<T, L>, F> by_item = { less };
+	list.first = sort_chain(link_ptr(list.first), by_item);
+}
+
+template <typename T, typename L, typename F>
+void list_sort(dlist_head<T, L> & list, F less)
+{
+	sort_by_item<dlist_item<T, L>, F> by_item = { less };
+	sort_relink(list, sort_chain(link_ptr(list.first), by_item));
+}
+
+template <typename T, typename L, typename F>
+void list_sort_parallel(list_head<T, L> & list, F less, unsigned threads = std::thread::hardware_concurrency())
+{
+	sort_by_item<list_item<T, L>, F> by_item = { less };
+	list.first = sort_chain_parallel(link_ptr(list.first), by_item, threads);
+}
+
+template <typename T, typename L, typename F>
+void list_sort_parallel(dlist_head<T, L> & list, F less, unsigned threads = std::thread::hardware_concurrency())
+{
+	sort_by_item<dlist_item<T, L>, F> by_item = { less };
+	sort_relink(list, sort_chain_parallel(link_ptr(list.first), by_item, threads));
+}
+
+/*
+ *	Same, with the field given explicitly and no CONTAINER_OF()
+ */
+#if __cplusplus >= 201703L
+
+template <auto field, typename F>
+struct sort_by_field
+{
+	typedef typename member_path<field>::member I;
+
+	F & less;
+
+	bool operator() (I * a, I * b) const { return less(container_of<field>(a), container_of<field>(b)); }
+};
+
+template <auto field, typename T, typename L, typename F>
+void list_sort(list_head<T, L> & list, F less)
+{
+	sort_by_field<field, F> by_item = { less };
+	list.first = sort_chain(link_ptr(list.first), by_item);
+}
+
+template <auto field, typename T, typename L, typename F>
+void list_sort(dlist_head<T, L> & list, F less)
+{
+	sort_by_field<field, F> by_item = { less };
+	sort_relink(list, sort_chain(link_ptr(list.first), by_item));
+}
+
+template <auto field, typename T, typename L, typename F>
+void list_sort_parallel(list_head<T, L> & list, F less, unsigned threads = std::thread::hardware_concurrency())
+{
+	sort_by_field<field, F> by_item = { less };
+	list.first = sort_chain_parallel(link_ptr(list.first), by_item, threads);
+}
+
+template <auto field, typename T, typename L, typename F>
+void list_sort_parallel(dlist_head<T, L> & list, F less, unsigned threads = std::thread::hardware_concurrency())
+{
+	sort_by_field<field, F> by_item = { less };
+	sort_relink(list, sort_chain_parallel(link_ptr(list.first), by_item, threads));
+}
+
+#endif
+
+#endif
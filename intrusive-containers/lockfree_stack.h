@@ -0,0 +1,374 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _LOCKFREE_STACK_H_
+#define _LOCKFREE_STACK_H_
+
+#include "linked_list.h"    /* template_arg(), CONTAINER_OF() */
+
+#include <stdint.h>
+#include <assert.h>
+#include <atomic>
+
+/*
+ *	Stack item
+ */
+template <typename T>
+struct stack_item
+{
+	std::atomic<stack_item *> next;
+};
+
+/*
+ *	Tagged pointers
+ *
+ *	The top of the stack is a pointer and a counter. The counter
+ *	is bumped on every update of the top, so a pop() that was
+ *	preempted between reading the top and swapping it will fail
+ *	even if the same item was popped and pushed back in the
+ *	meantime (the ABA problem).
+ *
+ *	Where there's a double-width CAS, both are full 64 bits and
+ *	are swapped together. On x64 this needs cmpxchg16b, i.e. -mcx16
+ *	or -march=x86-64-v2 and up.
+ *
+ *	Otherwise they are packed into 64 bits. On 64-bit platforms
+ *	that's 48 bits of pointer and a 16-bit counter, on 32-bit ones
+ *	it's 32 and 32. This has two catches -
+ *
+ *	  - A pop() that is preempted for exactly 65536 updates of
+ *	    the top, or a multiple of that, will still see the ABA.
+ *	    This is unlikely, but it's not impossible.
+ *
+ *	  - Pointers must fit into 48 bits. That's all that user-mode
+ *	    x64 and ARM64 pointers normally use, but not with 5-level
+ *	    paging (LA57), when asking for high addresses explicitly,
+ *	    or with tags in the top byte (ARM TBI and MTE, e.g. for
+ *	    Android's tagged heap). This is assert()'ed on every push.
+ *	    On these STACK_PTR_BITS can be raised, at the expense of
+ *	    the counter.
+ */
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && ! defined(STACK_NO_DWCAS)
+#define STACK_DWCAS
+#endif
+
+#ifndef STACK_PTR_BITS
+#if UINTPTR_MAX > 0xffffffffu
+#define STACK_PTR_BITS  48
+#else
+#define STACK_PTR_BITS  32
+#endif
+#endif
+
+#define STACK_PTR_MASK  ((1ULL << STACK_PTR_BITS) - 1)
+#define STACK_TAG_ONE   (1ULL << STACK_PTR_BITS)
+
+#ifdef STACK_DWCAS
+
+struct stack_top
+{
+	typedef unsigned __int128 word;
+
+	alignas(16) word v;
+
+	stack_top() : v(0) { }
+
+	static uintptr_t ptr(word w)
+	{
+		return (uintptr_t)w;
+	}
+
+	static word pack(uintptr_t p, word prev)
+	{
+		return (word)p | ((prev >> 64) + 1) << 64;
+	}
+
+	/*
+	 *	There's no 16-byte atomic load, so the halves are read one
+	 *	by one, the counter first. A mix of two values can't be
+	 *	swapped - the counter will have moved on by then.
+	 */
+	word load(std::memory_order mo) const
+	{
+		const uint64_t * h = (const uint64_t *)&v;
+		uint64_t tag = __atomic_load_n(h + 1, mo);
+		uint64_t p   = __atomic_load_n(h + 0, mo);
+
+		return (word)tag << 64 | p;
+	}
+
+	bool cas(word & expected, word desired, std::memory_order, std::memory_order)
+	{
+		word seen = __sync_val_compare_and_swap(&v, expected, desired);
+
+		if (seen == expected)
+			return true;
+
+		expected = seen;
+		return false;
+	}
+};
+
+#else
+
+struct stack_top
+{
+	typedef uint64_t word;
+
+	std::atomic<uint64_t> v;
+
+	stack_top() : v(0) { }
+
+	static uintptr_t ptr(word w)
+	{
+		return (uintptr_t)(w & STACK_PTR_MASK);
+	}
+
+	static word pack(uintptr_t p, word prev)
+	{
+		assert( ! (p & ~STACK_PTR_MASK) );
+		return p | ((prev + STACK_TAG_ONE) & ~STACK_PTR_MASK);
+	}
+
+	word load(std::memory_order mo) const
+	{
+		return v.load(mo);
+	}
+
+	bool cas(word & expected, word desired, std::memory_order ok, std::memory_order fail)
+	{
+		return v.compare_exchange_weak(expected, desired, ok, fail);
+	}
+};
+
+#endif
+
+/*
+ *	Lock-free stack (Treiber)
+ *
+ *	pop() reads the 'next' of an item that another thread may've
+ *	just popped, so items must remain readable after they are
+ *	taken off the stack, i.e. they must not be returned to the
+ *	OS. This is naturally so for object pools, the main use of
+ *	this stack.
+ */
+template <typename T>
+struct stack_head
+{
+	typedef stack_item<T> item;
+	typedef stack_top::word word;
+
+	stack_top top;
+
+	stack_head() { }
+
+	stack_head(const stack_head &) = delete;
+	stack_head & operator = (const stack_head &) = delete;
+
+	static item * ptr_of(word v)
+	{
+		return (item*)stack_top::ptr(v);
+	}
+
+	static word pack(item * p, word prev)
+	{
+		return stack_top::pack((uintptr_t)p, prev);
+	}
+
+	bool empty() const
+	{
+		return ! ptr_of( top.load(std::memory_order_relaxed) );
+	}
+
+	void push(item * it)
+	{
+		push_chain(it, it);
+	}
+
+	/*
+	 *	Pushes a chain of items that are already linked through
+	 *	their 'next' fields, from 'first' to 'last'. The chain
+	 *	ends up on the stack in the same order.
+	 */
+	void push_chain(item * first, item * last)
+	{
+		word v = top.load(std::memory_order_relaxed);
+
+		do
+		{
+			last->next.store(ptr_of(v), std::memory_order_relaxed);
+		}
+		while (! top.cas(v, pack(first, v),
+		                 std::memory_order_release,
+		                 std::memory_order_relaxed));
+	}
+
+	item * pop()
+	{
+		word v = top.load(std::memory_order_acquire);
+		item * p;
+
+		do
+		{
+			p = ptr_of(v);
+			if (! p)
+				return NULL;
+		}
+		while (! top.cas(v, pack(p->next.load(std::memory_order_relaxed), v),
+		                 std::memory_order_acquire,
+		                 std::memory_order_acquire));
+		return p;
+	}
+
+	/*
+	 *	Takes up to 'max' items off the top as a NULL-terminated
+	 *	chain. Same as with pop(), the items are read before the
+	 *	swap, which fails if any of them were taken in between.
+	 */
+	item * pop_chain(size_t max)
+	{
+		word v = top.load(std::memory_order_acquire);
+		item * p, * last, * n;
+		size_t k;
+
+		do
+		{
+			p = ptr_of(v);
+			if (! p)
+				return NULL;
+
+			for (last = p, k = 1; k < max && (n = next(last)); k++)
+				last = n;
+		}
+		while (! top.cas(v, pack(next(last), v),
+		                 std::memory_order_acquire,
+		                 std::memory_order_acquire));
+
+		last->next.store(NULL, std::memory_order_relaxed);
+		return p;
+	}
+
+	/*
+	 *	Takes the whole stack as a NULL-terminated chain
+	 */
+	item * pop_all()
+	{
+		word v = top.load(std::memory_order_relaxed);
+
+		while (ptr_of(v) &&
+		       ! top.cas(v, pack(NULL, v),
+		                 std::memory_order_acquire,
+		                 std::memory_order_relaxed));
+
+		return ptr_of(v);
+	}
+
+	static item * next(item * it)
+	{
+		return it->next.load(std::memory_order_relaxed);
+	}
+};
+
+/*
+ *	Per-thread cache in front of a shared stack
+ *
+ *		thread_local STACK_CACHE(buffer, pool_item)  cache(pool);
+ *
+ *		p = cache.pop();
+ *		...
+ *		cache.push(p);
+ *
+ *	Hits touch only the cache, which is private to the thread.
+ *	When the cache is empty, it takes 'max' / 2 items from the
+ *	shared stack in one go, so that other threads still get
+ *	theirs. When it grows past 'max', it returns everything back
+ *	to the shared stack with a single push_chain().
+ *
+ *	The cache returns its items to the shared stack when it's
+ *	destroyed, i.e. on the thread exit.
+ */
+template <typename T>
+struct stack_cache
+{
+	typedef stack_item<T> item;
+
+	stack_head<T> & shared;
+	item        * first;
+	item        * last;
+	size_t        count;
+	size_t        max;
+
+	stack_cache(stack_head<T> & s, size_t max_ = 64) : shared(s), first(NULL), last(NULL), count(0), max(max_) { }
+	~stack_cache() { flush(); }
+
+	stack_cache(const stack_cache &) = delete;
+	stack_cache & operator = (const stack_cache &) = delete;
+
+	void push(item * it)
+	{
+		if (count >= max)
+			flush();
+
+		it->next.store(first, std::memory_order_relaxed);
+		if (! first) last = it;
+		first = it;
+		count++;
+	}
+
+	item * pop()
+	{
+		item * p;
+
+		if (! first)
+			refill();
+
+		if (! (p = first))
+			return NULL;
+
+		first = shared.next(p);
+		if (! first) last = NULL;
+		count--;
+		return p;
+	}
+
+	void flush()
+	{
+		if (! first)
+			return;
+
+		shared.push_chain(first, last);
+		first = last = NULL;
+		count = 0;
+	}
+
+	void refill()
+	{
+		item * p;
+
+		first = shared.pop_chain(max > 1 ? max / 2 : 1);
+
+		for (p = first, count = 0; p; p = shared.next(p), count++)
+			last = p;
+	}
+};
+
+/*
+ *	The boilerplate, same as for the lists
+ */
+#define STACK_ITEM          STACK_ITEM_1(__LINE__)
+#define STACK_ITEM_1(inst)  STACK_ITEM_2(inst)
+#define STACK_ITEM_2(inst)  struct stack_inst_ ## inst { }; \
+                            stack_item<stack_inst_ ## inst>
+
+template <typename T>
+auto template_arg(stack_item<T> &) -> T;
+
+#define STACK_HEAD_TYPE(T, field)  stack_head<decltype(template_arg(T::field))>
+#define STACK_ITEM_TYPE(T, field)  stack_item<decltype(template_arg(T::field))>
+
+#define STACK_HEAD(T, field)   STACK_HEAD_TYPE(T, field)
+#define STACK_CACHE(T, field)  stack_cache<decltype(template_arg(T::field))>
+
+#endif
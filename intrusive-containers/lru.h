@@ -0,0 +1,266 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _LRU_H_
+#define _LRU_H_
+
+#include "linked_list.h"
+#include "hash_table.h"
+#include "cache_layout.h"
+
+#include <mutex>
+
+/*
+ *	Default LRU weight - each object counts as one, so the
+ *	capacity is the number of objects.
+ */
+struct lru_count
+{
+	template <typename T>
+	static size_t weight(const T *) { return 1; }
+};
+
+/*
+ *	LRU cache
+ *
+ *	This links objects into a hash table for lookups and into a
+ *	doubly-linked list for the recency order, most recent first.
+ *	Both are intrusive, so the cache allocates nothing past the
+ *	hash table's bucket array.
+ *
+ *		INTRUSIVE_LRU(foo, by_key, by_use, key)  lru(1000);
+ *
+ *		lru.add(p);
+ *		while ((q = lru.evict()))
+ *			delete q;
+ *		...
+ *		p = lru.find(k);    // also moves 'p' to the front
+ *
+ *	The capacity is in the units of W::weight(), which can also
+ *	be something like a buffer size:
+ *
+ *		struct by_size { static size_t weight(const foo * p) { return p->size; } };
+ *
+ *		INTRUSIVE_LRU(foo, by_key, by_use, key, by_size)  lru(64*1024*1024);
+ *
+ *	The weight of an object must not change while it is in the
+ *	cache. add() doesn't evict on its own; evict() returns the
+ *	least recently used object while the cache is over capacity,
+ *	so the caller can dispose of it as needed.
+ *
+ *	Since an object is on two containers, the lookups return the
+ *	object itself rather than one of its items.
+ */
+template <typename T,
+          typename HI, hash_item<HI>  T::*hash_field,
+          typename LI, dlist_item<LI> T::*list_field,
+          typename K,  K T::*key,
+          typename W = lru_count>
+struct lru_head
+{
+	typedef T  object;
+	typedef K  key_type;
+
+	hash_head<HI, T, K, key>  table;
+	dlist_head<LI>            order;
+	size_t                    weight;
+	size_t                    capacity;
+
+	lru_head(size_t capacity_ = (size_t)-1) : weight(0), capacity(capacity_) { }
+
+	size_t size() const { return table.size(); }
+	bool  empty() const { return table.empty(); }
+	bool   over() const { return weight > capacity; }
+
+	void add(T * obj)
+	{
+		table.add( &(obj->*hash_field) );
+		order.add_head( &(obj->*list_field) );
+		weight += W::weight(obj);
+	}
+
+	void del(T * obj)
+	{
+		table.del( &(obj->*hash_field) );
+		order.del( &(obj->*list_field) );
+		weight -= W::weight(obj);
+	}
+
+	void touch(T * obj)
+	{
+		dlist_item<LI> * it = &(obj->*list_field);
+
+		if (order.first == it)
+			return;
+
+		order.del(it);
+		order.add_head(it);
+	}
+
+	T * find(const K & k)
+	{
+		T * obj = peek(k);
+		if (obj) touch(obj);
+		return obj;
+	}
+
+	T * peek(const K & k) const
+	{
+		hash_item<HI> * it = table.find(k);
+		return it ? container_of(it) : NULL;
+	}
+
+	static const K & key_of(const T * obj)     { return obj->*key; }
+	static dlist_item<LI> * list_of(T * obj)  { return &(obj->*list_field); }
+
+	T * oldest() const
+	{
+		return order.last ? container_of(order.last) : NULL;
+	}
+
+	/*
+	 *	Removes and returns the least recently used object if the
+	 *	cache is over capacity, NULL otherwise
+	 */
+	T * evict()
+	{
+		T * obj;
+
+		if (! over() || ! (obj = oldest()))
+			return NULL;
+
+		del(obj);
+		return obj;
+	}
+};
+
+/*
+ *	Sharded LRU
+ *
+ *	N independent LRUs, each with 1/N of the capacity and its own
+ *	lock, with objects spread over them by the key hash. The LRU
+ *	order is therefore per shard, which is usually close enough.
+ *	N must be a power of two, up to 256.
+ *
+ *	Objects that are returned by find() may be evicted by another
+ *	thread at any moment, so find() takes a callback that is run
+ *	with the shard locked. add() collects evicted objects on a
+ *	list, threaded through their now unused 'list_field' items,
+ *	and hands them over to 'on_evict' after it unlocks the shard.
+ *	They are off all lists by then, so 'on_evict' can add them
+ *	back, to this cache or any other.
+ */
+template <typename L, size_t N = 16>
+struct lru_sharded
+{
+	typedef typename L::object    T;
+	typedef typename L::key_type  K;
+
+	struct shard
+	{
+		CACHE_ALIGNED
+		std::mutex  lock;
+		L           lru;
+	};
+
+	static_assert(N && ! (N & (N-1)) && N <= 256, "N must be a power of two, up to 256");
+
+	shard shards[N];
+
+	lru_sharded(size_t capacity = (size_t)-1)
+	{
+		set_capacity(capacity);
+	}
+
+	/*
+	 *	Rounded up, so that a capacity that is less than N doesn't
+	 *	make every shard evict everything
+	 */
+	void set_capacity(size_t capacity)
+	{
+		size_t i;
+
+		if (capacity != (size_t)-1)
+			capacity = capacity / N + (capacity % N != 0);
+
+		for (i = 0; i < N; i++)
+			shards[i].lru.capacity = capacity;
+	}
+
+	shard & shard_of(const K & k)
+	{
+		/* the top bits, the bottom ones pick the bucket in the shard */
+		return shards[ (hash_of<K>::get(k) >> (8*sizeof(size_t) - 8)) & (N-1) ];
+	}
+
+	template <typename F>
+	void add(T * obj, F on_evict)
+	{
+		shard & s = shard_of( L::key_of(obj) );
+		decltype(s.lru.order) evicted;
+		T * p;
+
+		s.lock.lock();
+		s.lru.add(obj);
+		while ((p = s.lru.evict()))
+			evicted.add_tail( L::list_of(p) );
+		s.lock.unlock();
+
+		/* off the list first, so they can be added again */
+		while (auto q = evicted.first)
+		{
+			evicted.del(q);
+			on_evict(container_of(q));
+		}
+	}
+
+	template <typename F>
+	bool find(const K & k, F f)
+	{
+		shard & s = shard_of(k);
+		std::lock_guard<std::mutex> guard(s.lock);
+		T * obj = s.lru.find(k);
+
+		if (! obj)
+			return false;
+
+		f(obj);
+		return true;
+	}
+
+	/*
+	 *	Removes the object with the key and returns it, it's then
+	 *	up to the caller to dispose of it
+	 */
+	T * remove(const K & k)
+	{
+		shard & s = shard_of(k);
+		std::lock_guard<std::mutex> guard(s.lock);
+		T * obj = s.lru.peek(k);
+
+		if (obj)
+			s.lru.del(obj);
+
+		return obj;
+	}
+};
+
+/*
+ *	INTRUSIVE_LRU(T, hash_field, list_field, key_field [, weight])
+ *
+ *	'hash_field' and 'list_field' are a HASH_ITEM and a DLIST_ITEM
+ *	of T and both need CONTAINER_OF() declared.
+ */
+#define INTRUSIVE_LRU_TYPE(T, hash_field, list_field, key_field, ...)               \
+	lru_head<T, decltype(template_arg(T::hash_field)), &T::hash_field,          \
+	            decltype(template_arg(T::list_field)), &T::list_field,          \
+	            decltype(T::key_field), &T::key_field, ##__VA_ARGS__>
+
+#define INTRUSIVE_LRU(T, hash_field, list_field, key_field, ...)  \
+	INTRUSIVE_LRU_TYPE(T, hash_field, list_field, key_field, ##__VA_ARGS__)
+
+#define INTRUSIVE_LRU_SHARDED(N, T, hash_field, list_field, key_field, ...)  \
+	lru_sharded<INTRUSIVE_LRU_TYPE(T, hash_field, list_field, key_field, ##__VA_ARGS__), N>
+
+#endif
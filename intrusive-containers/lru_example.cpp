@@ -0,0 +1,137 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ *
+ *	g++ -std=c++11 -pthread lru_example.cpp
+ */
+#include "lru.h"
+#include <assert.h>
+
+struct page
+{
+	int     id;
+	size_t  size;
+
+	HASH_ITEM   by_id;
+	DLIST_ITEM  by_use;
+};
+
+CONTAINER_OF(page, by_id);
+CONTAINER_OF(page, by_use);
+
+struct by_size
+{
+	static size_t weight(const page * p) { return p->size; }
+};
+
+static page  pg[8];
+
+/*
+ *	Recency order, most recent first
+ */
+static bool order_is(INTRUSIVE_LRU(page, by_id, by_use, id) & lru, const char * ids)
+{
+	for (page * p : lru.order)
+		if (*ids++ != '0' + p->id)
+			return false;
+
+	return ! *ids;
+}
+
+void test()
+{
+	INTRUSIVE_LRU(page, by_id, by_use, id)  lru(4);
+	int  i;
+
+	for (i = 0; i < 8; i++)
+		pg[i].id = i, pg[i].size = i;
+
+	/*
+	 *	add() doesn't evict, evict() does while over capacity
+	 */
+	for (i = 0; i < 5; i++)
+		lru.add(&pg[i]);
+
+	assert(lru.over());
+	assert(order_is(lru, "43210"));
+
+	assert(lru.evict() == &pg[0]);
+	assert(! lru.evict());
+	assert(! lru.peek(0));
+
+	/*
+	 *	find() moves to the front, peek() doesn't
+	 */
+	assert(lru.find(1) == &pg[1]);
+	assert(order_is(lru, "1432"));
+
+	assert(lru.peek(2) == &pg[2]);
+	assert(order_is(lru, "1432"));
+
+	lru.add(&pg[5]);
+	assert(lru.evict() == &pg[2]);
+	assert(order_is(lru, "5143"));
+
+	lru.del(&pg[4]);
+	assert(order_is(lru, "513"));
+	assert(! lru.over() && lru.size() == 3);
+
+	/*
+	 *	capacity in bytes rather than items
+	 */
+	INTRUSIVE_LRU(page, by_id, by_use, id, by_size)  bytes(10);
+	page * p;
+
+	while ((p = lru.oldest()))
+		lru.del(p);
+
+	for (i = 1; i < 6; i++)          /* 1+2+3+4+5 = 15 */
+		bytes.add(&pg[i]);
+
+	assert(bytes.evict() == &pg[1]); /* 14 */
+	assert(bytes.evict() == &pg[2]); /* 12 */
+	assert(bytes.evict() == &pg[3]); /*  9 */
+	assert(! bytes.evict());
+	assert(bytes.weight == 9);
+
+	while ((p = bytes.oldest()))
+		bytes.del(p);
+}
+
+/*
+ *	Sharded, with evicted pages going back to a free list
+ */
+void test_sharded()
+{
+	INTRUSIVE_LRU_SHARDED(4, page, by_id, by_use, id)  cache(4);
+	DLIST_HEAD(page, by_use)  free_pages;
+	int  i, found, evicted = 0;
+
+	for (i = 0; i < 8; i++)
+		cache.add(&pg[i], [&](page * p){ free_pages.add_tail(&p->by_use); evicted++; });
+
+	/* one per shard, whichever the ids fall into */
+	for (auto & s : cache.shards)
+		assert(s.lru.size() <= 1);
+
+	for (found = 0, i = 0; i < 8; i++)
+		found += cache.find(i, [&](page * p){ assert(p->id == i); });
+
+	for (page * p : free_pages)
+		assert(! cache.find(p->id, [](page *){ }));
+
+	assert(found == 8 - evicted);
+
+	for (i = 0; i < 8; i++)
+		if (page * p = cache.remove(i))
+			assert(p == &pg[i]), found--;
+
+	assert(! found);
+}
+
+int main()
+{
+	test();
+	test_sharded();
+	return 0;
+}
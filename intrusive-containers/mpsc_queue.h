@@ -0,0 +1,200 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _MPSC_QUEUE_H_
+#define _MPSC_QUEUE_H_
+
+#include "linked_list.h"    /* template_arg(), CONTAINER_OF() */
+
+#include <atomic>
+#include <thread>
+
+/*
+ *	MPSC queue item
+ *
+ *	This is a list_item with an atomic 'next'. Same as with lists,
+ *	the link type is the second template argument, see offset_ptr.h.
+ */
+template <typename T, typename L = raw_links>
+struct mpsc_item
+{
+	typename L::template atomic_ptr<mpsc_item> next;
+};
+
+/*
+ *	Multi-producer, single-consumer queue
+ *
+ *	This is Dmitry Vyukov's intrusive MPSC queue. Producers push
+ *	to the 'head' with a single atomic exchange, so push() is
+ *	wait-free. The consumer pops from the 'tail' and it's the
+ *	only one to touch it, so pop() needs no atomic RMW at all.
+ *
+ *	The queue always contains a stub item, which is re-queued
+ *	whenever the consumer takes the last real item.
+ *
+ *	There's a window in push() between the exchange and linking
+ *	of the previous item to the new one. If a producer gets
+ *	preempted there, pop() will see the queue as empty until the
+ *	producer gets to run again. drain() will spin through it.
+ *
+ *	Only one thread may be calling pop() and drain() at a time.
+ */
+template <typename T, typename L = raw_links>
+struct mpsc_head
+{
+	typedef mpsc_item<T, L> item;
+
+	alignas(64)
+	typename L::template atomic_ptr<item> head;   /* producers' end */
+
+	alignas(64)
+	typename L::template ptr<item> tail;          /* consumer's end */
+	item   stub[2];
+	int    cur;                                   /* stub[cur] is in use */
+
+	mpsc_head() : cur(0)
+	{
+		stub[0].next.store(NULL, std::memory_order_relaxed);
+		stub[1].next.store(NULL, std::memory_order_relaxed);
+
+		head.store(stub, std::memory_order_relaxed);
+		tail = stub;
+	}
+
+	mpsc_head(const mpsc_head &) = delete;
+	mpsc_head & operator = (const mpsc_head &) = delete;
+
+	/*
+	 *	Any thread
+	 */
+	void push(item * it)
+	{
+		item * prev;
+
+		it->next.store(NULL, std::memory_order_relaxed);
+		prev = head.exchange(it, std::memory_order_acq_rel);
+		prev->next.store(it, std::memory_order_release);
+	}
+
+	/*
+	 *	Consumer only
+	 */
+	bool empty() const
+	{
+		return tail == stub + cur &&
+		       ! tail->next.load(std::memory_order_acquire);
+	}
+
+	item * pop()
+	{
+		item * t = tail;
+		item * n = t->next.load(std::memory_order_acquire);
+
+		if (t == stub + cur)
+		{
+			if (! n)
+				return NULL;
+
+			tail = t = n;
+			n = n->next.load(std::memory_order_acquire);
+		}
+
+		if (n)
+		{
+			tail = n;
+			return t;
+		}
+
+		if (t != head.load(std::memory_order_acquire))
+			return NULL;  /* a push() is in progress */
+
+		push(stub + cur);
+
+		n = t->next.load(std::memory_order_acquire);
+		if (n)
+		{
+			tail = n;
+			return t;
+		}
+
+		return NULL;
+	}
+
+	/*
+	 *	Takes everything that was pushed so far with one exchange
+	 *	and returns it as a NULL-terminated chain in FIFO order -
+	 *
+	 *		for (p = q.drain(); p; p = n)
+	 *		{
+	 *			n = q.next(p);
+	 *			...
+	 *		}
+	 *
+	 *	This swaps in the other stub as the new head, so that the
+	 *	current one can be unlinked from the chain if it's on it.
+	 */
+	item * drain()
+	{
+		item * fresh = stub + (cur ^ 1);
+		item * last, * first, * prev, * p, * n;
+
+		fresh->next.store(NULL, std::memory_order_relaxed);
+		last = head.exchange(fresh, std::memory_order_acq_rel);
+
+		first = prev = NULL;
+
+		for (p = tail; ; p = n)
+		{
+			n = NULL;
+
+			if (p != last)
+				while (! (n = p->next.load(std::memory_order_acquire)))
+					std::this_thread::yield();
+
+			if (p != stub + cur)
+			{
+				if (prev) prev->next.store(p, std::memory_order_relaxed);
+				else      first = p;
+
+				prev = p;
+			}
+
+			if (p == last)
+				break;
+		}
+
+		if (prev)
+			prev->next.store(NULL, std::memory_order_relaxed);
+
+		tail = fresh;
+		cur ^= 1;
+		return first;
+	}
+
+	static item * next(item * it)
+	{
+		return it->next.load(std::memory_order_relaxed);
+	}
+};
+
+/*
+ *	The boilerplate, same as for the lists
+ */
+#define MPSC_ITEM          MPSC_ITEM_1(__LINE__)
+#define MPSC_ITEM_1(inst)  MPSC_ITEM_2(inst)
+#define MPSC_ITEM_2(inst)  struct mpsc_inst_ ## inst { }; \
+                           mpsc_item<mpsc_inst_ ## inst>
+
+template <typename T, typename L>
+auto template_arg(mpsc_item<T, L> &) -> T;
+
+template <typename T, typename L>
+auto links_arg(mpsc_item<T, L> &) -> L;
+
+#define MPSC_HEAD_TYPE(T, field)  mpsc_head<decltype(template_arg(T::field)), decltype(links_arg(T::field))>
+#define MPSC_ITEM_TYPE(T, field)  mpsc_item<decltype(template_arg(T::field)), decltype(links_arg(T::field))>
+
+#define MPSC_HEAD(T, field)  MPSC_HEAD_TYPE(T, field)
+
+#endif
@@ -0,0 +1,152 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _OFFSET_PTR_H_
+#define _OFFSET_PTR_H_
+
+#include "linked_list.h"
+
+#include <stdint.h>
+#include <atomic>
+
+/*
+ *	Self-relative pointer
+ *
+ *	Stores the distance from itself to the target, so a structure
+ *	that is linked up with these can be moved around in memory
+ *	as a whole - copied, persisted and loaded back, or mapped at
+ *	different addresses in different processes - and it remains
+ *	valid without any fix-ups.
+ *
+ *	0 is NULL, so it can't point at itself, which no list link
+ *	needs to.
+ *
+ *	Copying one recomputes the offset for its new location, so it
+ *	still points at the same target.
+ *
+ *	The math is done on integers. With 'char *' the compiler may
+ *	assume, correctly, that the result points into the offset_ptr
+ *	itself and miscompile accesses through it.
+ */
+template <typename T>
+struct offset_ptr
+{
+	intptr_t off;
+
+	offset_ptr()                      : off(0) { }
+	offset_ptr(T * p)                 { set(p); }
+	offset_ptr(const offset_ptr & p)  { set(p.get()); }
+
+	offset_ptr & operator = (const offset_ptr & p) { set(p.get()); return *this; }
+	offset_ptr & operator = (T * p)                { set(p);       return *this; }
+
+	T * get() const { return off ? (T*)((uintptr_t)this + off) : NULL; }
+
+	operator T * ()     const { return get(); }
+	T * operator -> ()  const { return get(); }
+
+	void set(T * p) { off = p ? (intptr_t)((uintptr_t)p - (uintptr_t)this) : 0; }
+};
+
+template <typename X>
+X * link_ptr(const offset_ptr<X> & p) { return p.get(); }
+
+/*
+ *	Self-relative std::atomic<T *>, the parts of it that the MPSC
+ *	queue needs. The offset is relative to the atomic itself, so
+ *	exchange() works across processes that have the region mapped
+ *	at different addresses.
+ */
+template <typename T>
+struct atomic_offset_ptr
+{
+	std::atomic<intptr_t> off;
+
+	atomic_offset_ptr() : off(0) { }
+
+	atomic_offset_ptr(const atomic_offset_ptr &) = delete;
+	atomic_offset_ptr & operator = (const atomic_offset_ptr &) = delete;
+
+	T * load(std::memory_order mo = std::memory_order_seq_cst) const
+	{
+		return abs(off.load(mo));
+	}
+
+	void store(T * p, std::memory_order mo = std::memory_order_seq_cst)
+	{
+		off.store(rel(p), mo);
+	}
+
+	T * exchange(T * p, std::memory_order mo = std::memory_order_seq_cst)
+	{
+		return abs(off.exchange(rel(p), mo));
+	}
+
+	intptr_t rel(T * p) const { return p ? (intptr_t)((uintptr_t)p - (uintptr_t)this) : 0; }
+	T * abs(intptr_t o) const { return o ? (T*)((uintptr_t)this + o) : NULL; }
+};
+
+/*
+ *	The link type for list_item, dlist_item, hash_item, mpsc_item
+ *	and their heads
+ */
+struct offset_links
+{
+	template <typename X> using ptr = offset_ptr<X>;
+	template <typename X> using atomic_ptr = atomic_offset_ptr<X>;
+};
+
+/*
+ *	Relocatable items
+ *
+ *		struct session
+ *		{
+ *			...
+ *			LIST_ITEM_OFFSET  by_user;
+ *			DLIST_ITEM_OFFSET by_age;
+ *			HASH_ITEM_OFFSET  by_id;
+ *			MPSC_ITEM_OFFSET  pending;
+ *		};
+ *
+ *	LIST_HEAD(session, by_user) and the rest work the same as for
+ *	regular items. Then, if the sessions and the heads are all in
+ *	the same memory region, e.g. an mmap'ed file or a shared memory
+ *	segment, the lists can be traversed at whatever address the
+ *	region is mapped at. The MPSC queue can be shared between the
+ *	processes that have the region mapped.
+ *
+ *	The heads need to be in the region too. Items on lists that
+ *	span regions are still linked correctly, but only as long as
+ *	the regions stay put relative to each other.
+ *
+ *	So do the hash table's buckets. The table starts with the one
+ *	embedded into the head and then it allocates them with its
+ *	allocator, which needs to be one that allocates in the region,
+ *	see hash_table.h.
+ *
+ *	Following a link is an add instead of a load, which is just
+ *	as fast in practice. Adding and removing items needs a bit of
+ *	extra arithmetic.
+ */
+#define LIST_ITEM_OFFSET          LIST_ITEM_OFFSET_1(__LINE__)
+#define LIST_ITEM_OFFSET_1(inst)  LIST_ITEM_OFFSET_2(inst)
+#define LIST_ITEM_OFFSET_2(inst)  struct list_ofs_inst_ ## inst { }; \
+                                  list_item<list_ofs_inst_ ## inst, offset_links>
+
+#define DLIST_ITEM_OFFSET          DLIST_ITEM_OFFSET_1(__LINE__)
+#define DLIST_ITEM_OFFSET_1(inst)  DLIST_ITEM_OFFSET_2(inst)
+#define DLIST_ITEM_OFFSET_2(inst)  struct dlist_ofs_inst_ ## inst { }; \
+                                   dlist_item<dlist_ofs_inst_ ## inst, offset_links>
+
+#define HASH_ITEM_OFFSET          HASH_ITEM_OFFSET_1(__LINE__)
+#define HASH_ITEM_OFFSET_1(inst)  HASH_ITEM_OFFSET_2(inst)
+#define HASH_ITEM_OFFSET_2(inst)  struct hash_ofs_inst_ ## inst { }; \
+                                  hash_item<hash_ofs_inst_ ## inst, offset_links>
+
+#define MPSC_ITEM_OFFSET          MPSC_ITEM_OFFSET_1(__LINE__)
+#define MPSC_ITEM_OFFSET_1(inst)  MPSC_ITEM_OFFSET_2(inst)
+#define MPSC_ITEM_OFFSET_2(inst)  struct mpsc_ofs_inst_ ## inst { }; \
+                                  mpsc_item<mpsc_ofs_inst_ ## inst, offset_links>
+
+#endif
@@ -0,0 +1,249 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _PAIRING_HEAP_H_
+#define _PAIRING_HEAP_H_
+
+#include "linked_list.h"    /* template_arg(), CONTAINER_OF() */
+
+/*
+ *	Pairing heap item
+ *
+ *	'child' is the leftmost child, 'next' is the next sibling and
+ *	'prev' is the previous sibling or, for the leftmost child,
+ *	the parent. Roots have no 'next' and 'prev'.
+ */
+template <typename T>
+struct heap_item
+{
+	heap_item * child;
+	heap_item * next;
+	heap_item * prev;
+
+	CHECKED_ITEM_FIELDS(raw_links)
+};
+
+/*
+ *	Pairing heap head
+ *
+ *	A min-heap of T's, ordered by the comparator's static less()
+ *	that is given two 'const T *'. For a max-heap, flip it.
+ *
+ *		struct by_deadline
+ *		{
+ *			static bool less(const task * a, const task * b) { return a->deadline < b->deadline; }
+ *		};
+ *
+ *		HEAP_HEAD(task, heap, by_deadline) run_queue;
+ *
+ *	add(), top() and meld() are O(1), pop() and del() are O(log n)
+ *	amortized. When an item's key is lowered while on the heap,
+ *	decrease() restores the order in O(1) amortized - the item is
+ *	cut from its parent along with its subtree and linked with
+ *	the root. If the key is raised instead, del() and add() it.
+ */
+template <typename I, typename T, typename C>
+struct heap_head
+{
+	typedef heap_item<I> item;
+
+	item   * root;
+	size_t   count;
+
+	CHECKED_HEAD_FIELDS
+
+	heap_head() : root(NULL), count(0) { }
+
+	bool   empty() const { return ! root; }
+	size_t size()  const { return count; }
+
+	item * top() const { return root; }
+
+	void add(item * it)
+	{
+		CHECK_ADD(this, it);
+		it->child = it->next = it->prev = NULL;
+		root = link(root, it);
+		count++;
+	}
+
+	item * pop()
+	{
+		item * it = root;
+
+		if (! it)
+			return NULL;
+
+		CHECK_DEL(this, it);
+		root = merge_pairs(it->child);
+		it->child = NULL;
+		count--;
+		return it;
+	}
+
+	void del(item * it)
+	{
+		if (it == root)
+		{
+			pop();
+			return;
+		}
+
+		CHECK_DEL(this, it);
+		cut(it);
+		root = link(root, merge_pairs(it->child));
+		it->child = NULL;
+		count--;
+	}
+
+	void decrease(item * it)
+	{
+		CHECK_ON(this, it);
+		if (it == root)
+			return;
+
+		cut(it);
+		root = link(root, it);
+	}
+
+	/*
+	 *	Moves all items of 'other' to this heap
+	 */
+	void meld(heap_head & other)
+	{
+		CHECK_OTHER(this, &other);
+#ifdef INTRUSIVE_CHECKED
+		for (item * p = other.root; p; p = walk(p))
+		{
+			CHECK_DEL(&other, p);
+			CHECK_ADD(this, p);
+		}
+#endif
+		root = link(root, other.root);
+		count += other.count;
+
+		other.root = NULL;
+		other.count = 0;
+	}
+
+	/*
+	 *	Internals
+	 */
+	static bool less(const item * a, const item * b)
+	{
+		return C::less(container_of((item*)a), container_of((item*)b));
+	}
+
+	/*
+	 *	Makes the larger of two roots the leftmost child of the
+	 *	smaller one
+	 */
+	static item * link(item * a, item * b)
+	{
+		item * t;
+
+		if (! a) return b;
+		if (! b) return a;
+
+		if (less(b, a))
+			t = a, a = b, b = t;
+
+		b->prev = a;
+		b->next = a->child;
+		if (a->child) a->child->prev = b;
+		a->child = b;
+
+		return a;
+	}
+
+	/*
+	 *	Detaches a subtree from its parent and siblings
+	 */
+	static void cut(item * it)
+	{
+		if (it->prev->child == it) it->prev->child = it->next;
+		else                       it->prev->next = it->next;
+
+		if (it->next) it->next->prev = it->prev;
+
+		it->next = it->prev = NULL;
+	}
+
+	/*
+	 *	The standard two-pass merge - link the siblings in pairs,
+	 *	left to right, then link the results into one, right to
+	 *	left. The results are stacked up through 'next' in between.
+	 */
+	static item * merge_pairs(item * p)
+	{
+		item * stack = NULL, * a, * b, * r;
+
+		while ((a = p))
+		{
+			b = a->next;
+			p = b ? b->next : NULL;
+
+			a->next = a->prev = NULL;
+
+			if (b)
+			{
+				b->next = b->prev = NULL;
+				a = link(a, b);
+			}
+
+			a->next = stack;
+			stack = a;
+		}
+
+		for (r = NULL; (a = stack); )
+		{
+			stack = a->next;
+			a->next = NULL;
+			r = link(r, a);
+		}
+
+		return r;
+	}
+
+#ifdef INTRUSIVE_CHECKED
+	/*
+	 *	Pre-order successor, for re-homing the items on meld()
+	 */
+	static item * walk(item * p)
+	{
+		if (p->child)
+			return p->child;
+
+		while (! p->next)
+		{
+			/* back to the leftmost sibling, then to the parent */
+			while (p->prev && p->prev->child != p)
+				p = p->prev;
+
+			if (! (p = p->prev))
+				return NULL;
+		}
+
+		return p->next;
+	}
+#endif
+};
+
+/*
+ *	The boilerplate, same as for the lists
+ */
+#define HEAP_ITEM          HEAP_ITEM_1(__LINE__)
+#define HEAP_ITEM_1(inst)  HEAP_ITEM_2(inst)
+#define HEAP_ITEM_2(inst)  struct heap_inst_ ## inst { }; \
+                           heap_item<heap_inst_ ## inst>
+
+template <typename T>
+auto template_arg(heap_item<T> &) -> T;
+
+#define HEAP_HEAD_TYPE(T, field, cmp)  heap_head<decltype(template_arg(T::field)), T, cmp>
+#define HEAP_ITEM_TYPE(T, field)       heap_item<decltype(template_arg(T::field))>
+
+#define HEAP_HEAD(T, field, cmp)  HEAP_HEAD_TYPE(T, field, cmp)
+
+#endif
@@ -0,0 +1,185 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ *
+ *	g++ -std=c++11 pairing_heap_example.cpp
+ */
+#include "pairing_heap.h"
+#include <assert.h>
+
+struct task
+{
+	int  deadline;
+	int  priority;
+
+	HEAP_ITEM  by_deadline;
+	HEAP_ITEM  by_priority;
+};
+
+CONTAINER_OF(task, by_deadline);
+CONTAINER_OF(task, by_priority);
+
+struct earliest
+{
+	static bool less(const task * a, const task * b) { return a->deadline < b->deadline; }
+};
+
+struct highest
+{
+	static bool less(const task * a, const task * b) { return a->priority > b->priority; }
+};
+
+typedef HEAP_HEAD(task, by_deadline, earliest)  deadline_heap;
+typedef HEAP_HEAD(task, by_priority, highest)   priority_heap;
+
+#define N  100
+
+static task  t[N], u[N];
+
+/*
+ *	Heap order and the child/next/prev links. Returns the number
+ *	of items in the subtree.
+ */
+static size_t check(deadline_heap::item * p)
+{
+	deadline_heap::item * c, * prev = p;
+	size_t n = 1;
+
+	for (c = p->child; c; prev = c, c = c->next)
+	{
+		assert(c->prev == prev);
+		assert(! deadline_heap::less(c, p));
+		n += check(c);
+	}
+
+	return n;
+}
+
+static void check(deadline_heap & h)
+{
+	assert(! h.root || (! h.root->next && ! h.root->prev));
+	assert((h.root ? check(h.root) : 0) == h.size());
+}
+
+void test()
+{
+	deadline_heap  deadlines;
+	priority_heap  priorities;
+	int  i, last;
+
+	/*
+	 *	compile-time checks
+	 */
+	deadlines.add(&t[0].by_deadline);    // these will compile ...
+	priorities.add(&t[0].by_priority);
+
+//	deadlines.add(&t[0].by_priority);    // ... and these will not
+//	priorities.add(&t[0].by_deadline);
+
+	deadlines.pop();
+	priorities.pop();
+
+	for (i = 0; i < N; i++)
+	{
+		t[i].deadline = 1000 + (i * 37) % N;
+		t[i].priority = (i * 37) % N;
+		deadlines.add(&t[i].by_deadline);
+		priorities.add(&t[i].by_priority);
+	}
+
+	check(deadlines);
+	assert(container_of(priorities.top())->priority == N - 1);
+
+	/*
+	 *	pop a few so there are subtrees, then move every 3rd item
+	 *	ahead of everything, those come out first, in the order
+	 *	they were moved in
+	 */
+	for (i = 0; i < 10; i++)
+		assert(container_of(deadlines.pop())->deadline == 1000 + i);
+
+	check(deadlines);
+
+	for (i = 0, last = 0; i < N; i++)
+	{
+		if (t[i].deadline < 1010 || i % 3)
+			continue;
+
+		t[i].deadline = last++;
+		deadlines.decrease(&t[i].by_deadline);
+		check(deadlines);
+	}
+
+	for (i = 0; i < last; i++)
+		assert(container_of(deadlines.pop())->deadline == i);
+
+	/*
+	 *	de-prioritize the rest by deleting from the middle
+	 */
+	for (i = 0; i < N; i++)
+		if (t[i].deadline >= 1010 && t[i].deadline % 2)
+		{
+			deadlines.del(&t[i].by_deadline);
+			check(deadlines);
+		}
+
+	for (last = -1; deadlines.size(); )
+	{
+		task * p = container_of(deadlines.pop());
+		assert(p->deadline > last && ! (p->deadline % 2));
+		last = p->deadline;
+	}
+
+	assert(deadlines.empty() && ! deadlines.top());
+}
+
+/*
+ *	meld() takes all of the other heap's items and leaves it empty
+ */
+void test_meld()
+{
+	deadline_heap  a, b;
+	int  i, last;
+
+	for (i = 0; i < N; i++)
+	{
+		t[i].deadline = 2 * i;
+		u[i].deadline = 2 * (N - i) - 1;
+		a.add(&t[i].by_deadline);
+		b.add(&u[i].by_deadline);
+	}
+
+	a.pop();
+	b.pop();
+
+	a.meld(b);
+	check(a);
+
+	assert(a.size() == 2 * N - 2 && b.empty() && ! b.size());
+
+	/* the melded items are now a's, incl. in checked mode */
+	u[N - 2].deadline = -1;
+	a.decrease(&u[N - 2].by_deadline);
+	a.del(&u[N / 2].by_deadline);
+	check(a);
+
+	assert(a.pop() == &u[N - 2].by_deadline);
+
+	for (last = 0; ! a.empty(); )
+	{
+		task * p = container_of(a.pop());
+		assert(p->deadline > last && p != &u[N / 2]);
+		last = p->deadline;
+	}
+
+	b.add(&u[N / 2].by_deadline);
+	assert(b.top() == &u[N / 2].by_deadline);
+	b.pop();
+}
+
+int main()
+{
+	test();
+	test_meld();
+	return 0;
+}
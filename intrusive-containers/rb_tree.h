@@ -0,0 +1,436 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _RB_TREE_H_
+#define _RB_TREE_H_
+
+#include "linked_list.h"    /* template_arg(), CONTAINER_OF() */
+
+/*
+ *	Red-black tree item
+ */
+template <typename T>
+struct tree_item
+{
+	tree_item * parent;
+	tree_item * left;
+	tree_item * right;
+	int         red;
+
+	CHECKED_ITEM_FIELDS(raw_links)
+};
+
+/*
+ *	Default key comparator. Anything with a static less() that
+ *	takes two keys will do.
+ */
+template <typename K>
+struct tree_less
+{
+	static bool less(const K & a, const K & b) { return a < b; }
+};
+
+/*
+ *	Red-black tree head
+ *
+ *	Same as with the hash table, 'I' is the item instance type,
+ *	'T' is the user struct and 'key' is the T's field the tree is
+ *	ordered by. The comparator is a template argument, so the
+ *	comparisons are inlined.
+ *
+ *	Equal keys are allowed and they are kept in the order they
+ *	were added in, i.e. find() and lower_bound() return the one
+ *	that was added first.
+ *
+ *	'first' and 'last' are the smallest and largest items. They
+ *	are maintained by add() and del(), so they are O(1) and the
+ *	in-order traversal looks just like that of lists -
+ *
+ *		for (auto p = tree.first; p; p = tree.next(p))
+ *			container_of(p)->...
+ *
+ *		for (auto p = tree.last; p; p = tree.prev(p))
+ *			...
+ *
+ *	It's OK to del() the current item while iterating as long as
+ *	next() or prev() is fetched before that.
+ */
+template <typename I, typename T, typename K, K T::*key, typename C = tree_less<K> >
+struct tree_head
+{
+	typedef tree_item<I> item;
+
+	item   * root;
+	item   * first;
+	item   * last;
+	size_t   count;
+
+	CHECKED_HEAD_FIELDS
+
+	tree_head() : root(NULL), first(NULL), last(NULL), count(0) { }
+
+	size_t size() const { return count; }
+	bool  empty() const { return ! root; }
+
+	static const K & key_of(item * it) { return container_of(it)->*key; }
+
+	void add(item * it)
+	{
+		const K & k = key_of(it);
+		item ** link = &root;
+		item  * parent = NULL;
+		bool    leftmost = true, rightmost = true;
+
+		CHECK_ADD(this, it);
+
+		while (*link)
+		{
+			parent = *link;
+
+			if (C::less(k, key_of(parent)))
+			{
+				link = &parent->left;
+				rightmost = false;
+			}
+			else
+			{
+				link = &parent->right;
+				leftmost = false;
+			}
+		}
+
+		it->parent = parent;
+		it->left = it->right = NULL;
+		it->red = 1;
+		*link = it;
+
+		if (leftmost)  first = it;
+		if (rightmost) last = it;
+
+		add_fixup(it);
+		count++;
+	}
+
+	void del(item * z)
+	{
+		item * y = z, * x, * x_parent;
+		int y_red = z->red;
+
+		CHECK_DEL(this, z);
+
+		if (z == first) first = next(z);
+		if (z == last)  last = prev(z);
+
+		if (! z->left)
+		{
+			x = z->right;
+			x_parent = z->parent;
+			replace(z, x);
+		}
+		else
+		if (! z->right)
+		{
+			x = z->left;
+			x_parent = z->parent;
+			replace(z, x);
+		}
+		else
+		{
+			/* swap in the successor */
+			for (y = z->right; y->left; y = y->left);
+
+			y_red = y->red;
+			x = y->right;
+
+			if (y->parent == z)
+			{
+				x_parent = y;
+			}
+			else
+			{
+				x_parent = y->parent;
+				replace(y, x);
+				y->right = z->right;
+				y->right->parent = y;
+			}
+
+			replace(z, y);
+			y->left = z->left;
+			y->left->parent = y;
+			y->red = z->red;
+		}
+
+		if (! y_red)
+			del_fixup(x, x_parent);
+
+		z->parent = z->left = z->right = NULL;
+		count--;
+	}
+
+	/*
+	 *	Lookups
+	 */
+	item * lower_bound(const K & k) const  /* first item with key >= k */
+	{
+		item * p, * r = NULL;
+
+		for (p = root; p; )
+			if (! C::less(key_of(p), k)) { r = p; p = p->left;  }
+			else                         {        p = p->right; }
+
+		return r;
+	}
+
+	item * upper_bound(const K & k) const  /* first item with key > k */
+	{
+		item * p, * r = NULL;
+
+		for (p = root; p; )
+			if (C::less(k, key_of(p))) { r = p; p = p->left;  }
+			else                       {        p = p->right; }
+
+		return r;
+	}
+
+	item * find(const K & k) const
+	{
+		item * p = lower_bound(k);
+		return (p && ! C::less(k, key_of(p))) ? p : NULL;
+	}
+
+	/*
+	 *	In-order traversal
+	 */
+	static item * next(item * p)
+	{
+		if (p->right)
+		{
+			for (p = p->right; p->left; p = p->left);
+			return p;
+		}
+
+		while (p->parent && p == p->parent->right)
+			p = p->parent;
+
+		return p->parent;
+	}
+
+	static item * prev(item * p)
+	{
+		if (p->left)
+		{
+			for (p = p->left; p->right; p = p->right);
+			return p;
+		}
+
+		while (p->parent && p == p->parent->left)
+			p = p->parent;
+
+		return p->parent;
+	}
+
+	/*
+	 *	Internals
+	 */
+	void replace(item * u, item * v)
+	{
+		if (! u->parent)               root = v;
+		else if (u == u->parent->left) u->parent->left = v;
+		else                           u->parent->right = v;
+
+		if (v) v->parent = u->parent;
+	}
+
+	void rotate_left(item * x)
+	{
+		item * y = x->right;
+
+		x->right = y->left;
+		if (y->left) y->left->parent = x;
+
+		replace(x, y);
+		y->left = x;
+		x->parent = y;
+	}
+
+	void rotate_right(item * x)
+	{
+		item * y = x->left;
+
+		x->left = y->right;
+		if (y->right) y->right->parent = x;
+
+		replace(x, y);
+		y->right = x;
+		x->parent = y;
+	}
+
+	static bool is_red(item * p) { return p && p->red; }
+
+	void add_fixup(item * z)
+	{
+		item * p, * g, * u;
+
+		while ((p = z->parent) && p->red)
+		{
+			g = p->parent;
+
+			if (p == g->left)
+			{
+				u = g->right;
+
+				if (is_red(u))
+				{
+					p->red = u->red = 0;
+					g->red = 1;
+					z = g;
+					continue;
+				}
+
+				if (z == p->right)
+				{
+					rotate_left(p);
+					z = p;
+					p = z->parent;
+				}
+
+				p->red = 0;
+				g->red = 1;
+				rotate_right(g);
+			}
+			else
+			{
+				u = g->left;
+
+				if (is_red(u))
+				{
+					p->red = u->red = 0;
+					g->red = 1;
+					z = g;
+					continue;
+				}
+
+				if (z == p->left)
+				{
+					rotate_right(p);
+					z = p;
+					p = z->parent;
+				}
+
+				p->red = 0;
+				g->red = 1;
+				rotate_left(g);
+			}
+		}
+
+		root->red = 0;
+	}
+
+	/*
+	 *	'x' may be NULL, hence the explicit 'x_parent'
+	 */
+	void del_fixup(item * x, item * x_parent)
+	{
+		item * w;
+
+		while (x != root && ! is_red(x))
+		{
+			if (x == x_parent->left)
+			{
+				w = x_parent->right;
+
+				if (w->red)
+				{
+					w->red = 0;
+					x_parent->red = 1;
+					rotate_left(x_parent);
+					w = x_parent->right;
+				}
+
+				if (! is_red(w->left) && ! is_red(w->right))
+				{
+					w->red = 1;
+					x = x_parent;
+					x_parent = x->parent;
+					continue;
+				}
+
+				if (! is_red(w->right))
+				{
+					w->left->red = 0;
+					w->red = 1;
+					rotate_right(w);
+					w = x_parent->right;
+				}
+
+				w->red = x_parent->red;
+				x_parent->red = 0;
+				w->right->red = 0;
+				rotate_left(x_parent);
+			}
+			else
+			{
+				w = x_parent->left;
+
+				if (w->red)
+				{
+					w->red = 0;
+					x_parent->red = 1;
+					rotate_right(x_parent);
+					w = x_parent->left;
+				}
+
+				if (! is_red(w->left) && ! is_red(w->right))
+				{
+					w->red = 1;
+					x = x_parent;
+					x_parent = x->parent;
+					continue;
+				}
+
+				if (! is_red(w->left))
+				{
+					w->right->red = 0;
+					w->red = 1;
+					rotate_left(w);
+					w = x_parent->left;
+				}
+
+				w->red = x_parent->red;
+				x_parent->red = 0;
+				w->left->red = 0;
+				rotate_right(x_parent);
+			}
+
+			x = root;
+		}
+
+		if (x) x->red = 0;
+	}
+};
+
+/*
+ *	The boilerplate, same as for the lists
+ */
+#define TREE_ITEM          TREE_ITEM_1(__LINE__)
+#define TREE_ITEM_1(inst)  TREE_ITEM_2(inst)
+#define TREE_ITEM_2(inst)  struct tree_inst_ ## inst { }; \
+                           tree_item<tree_inst_ ## inst>
+
+template <typename T>
+auto template_arg(tree_item<T> &) -> T;
+
+#define TREE_HEAD_TYPE(T, field, key_field, ...)                  \
+	tree_head<decltype(template_arg(T::field)), T,            \
+	          decltype(T::key_field), &T::key_field, ##__VA_ARGS__>
+
+#define TREE_ITEM_TYPE(T, field)  tree_item<decltype(template_arg(T::field))>
+
+/*
+ *	TREE_HEAD(T, field, key_field) or, with a custom comparator,
+ *	TREE_HEAD(T, field, key_field, comparator)
+ */
+#define TREE_HEAD(T, field, key_field, ...)  TREE_HEAD_TYPE(T, field, key_field, ##__VA_ARGS__)
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ *
+ *	g++ -std=c++11 rb_tree_example.cpp
+ */
+#include "rb_tree.h"
+#include <assert.h>
+
+struct entry
+{
+	int  key;
+	int  seq;
+
+	TREE_ITEM  by_key;
+	TREE_ITEM  by_seq;
+};
+
+CONTAINER_OF(entry, by_key);
+CONTAINER_OF(entry, by_seq);
+
+struct descending
+{
+	static bool less(int a, int b) { return a > b; }
+};
+
+typedef TREE_HEAD(entry, by_key, key)              key_tree;
+typedef TREE_HEAD(entry, by_seq, seq, descending)  seq_tree;
+
+/*
+ *	Keys 0, 0, 0, 10, 10, 10, ..., 90, 90, 90
+ */
+#define N  30
+
+static entry  e[N];
+
+/*
+ *	Red-black rules, the parent links and the count. Returns the
+ *	black height.
+ */
+static int check(key_tree::item * p, key_tree::item * parent)
+{
+	int l, r;
+
+	if (! p)
+		return 1;
+
+	assert(p->parent == parent);
+	assert(! (p->red && parent && parent->red));
+
+	l = check(p->left, p);
+	r = check(p->right, p);
+	assert(l == r);
+
+	return l + ! p->red;
+}
+
+static void check(key_tree & t)
+{
+	size_t n = 0;
+
+	assert(! t.root || ! t.root->red);
+	check(t.root, NULL);
+
+	for (auto p = t.first; p; p = t.next(p))
+		n++;
+
+	assert(n == t.size());
+}
+
+void test()
+{
+	key_tree  keys;
+	seq_tree  seqs;
+
+	TREE_ITEM_TYPE(entry, by_key) * p, * n;
+	int  i, k;
+
+	/*
+	 *	compile-time checks
+	 */
+	keys.add(&e[0].by_key);    // these will compile ...
+	seqs.add(&e[0].by_seq);
+
+//	keys.add(&e[0].by_seq);    // ... and these will not
+//	seqs.add(&e[0].by_key);
+
+	keys.del(&e[0].by_key);
+	seqs.del(&e[0].by_seq);
+
+	/*
+	 *	added out of order, equal keys in their 'seq' order
+	 */
+	for (i = 0; i < N; i++)
+	{
+		k = (i * 7) % N;
+		e[k].key = (k / 3) * 10;
+		e[k].seq = i;
+		keys.add(&e[k].by_key);
+		seqs.add(&e[k].by_seq);
+		check(keys);
+	}
+
+	assert(container_of(keys.first)->key == 0);
+	assert(container_of(keys.last)->key == 90);
+	assert(container_of(seqs.first)->seq == N - 1);
+
+	for (p = keys.first; (n = keys.next(p)); p = n)
+	{
+		entry * a = container_of(p), * b = container_of(n);
+		assert(a->key < b->key || (a->key == b->key && a->seq < b->seq));
+	}
+
+	/*
+	 *	lower_bound is the first of equal keys, upper_bound is the
+	 *	one past the last of them, both are NULL past the end
+	 */
+	for (k = -5; k <= 95; k += 5)
+	{
+		auto lo = keys.lower_bound(k);
+		auto hi = keys.upper_bound(k);
+
+		if (k > 90)
+		{
+			assert(! lo && ! hi);
+			continue;
+		}
+
+		assert(container_of(lo)->key == (k <= 0 ? 0 : (k + 9) / 10 * 10));
+		assert(! keys.prev(lo) || container_of(keys.prev(lo))->key < k);
+
+		if (k >= 0 && k % 10 == 0)
+		{
+			assert(keys.find(k) == lo);
+			assert(container_of(keys.next(keys.next(lo)))->key == k);
+			assert(keys.next(keys.next(keys.next(lo))) == hi);
+			assert(! hi || container_of(hi)->key == k + 10);
+		}
+		else
+		{
+			assert(lo == hi);
+			assert(! keys.find(k));
+		}
+	}
+
+	/*
+	 *	removal while iterating, both ways
+	 */
+	for (p = keys.first; p; p = n)
+	{
+		n = keys.next(p);
+		if (container_of(p)->seq & 1)
+			keys.del(p);
+		check(keys);
+	}
+
+	for (p = keys.last; p; p = n)
+	{
+		n = keys.prev(p);
+		keys.del(p);
+		check(keys);
+	}
+
+	assert(keys.empty() && ! keys.first && ! keys.last);
+}
+
+int main()
+{
+	test();
+	return 0;
+}
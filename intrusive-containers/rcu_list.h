@@ -0,0 +1,171 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _RCU_LIST_H_
+#define _RCU_LIST_H_
+
+#include "linked_list.h"    /* template_arg(), CONTAINER_OF() */
+#include "ebr.h"
+
+#include <atomic>
+
+/*
+ *	RCU list item
+ *
+ *	Readers only follow 'next'. The 'prev' link is for writers
+ *	and, once the item is removed, it's reused for putting the
+ *	item on the EBR retire list, so the item is 3 pointers in
+ *	total.
+ */
+template <typename T>
+struct rcu_item
+{
+	std::atomic<rcu_item *> next;
+	ebr_node                link;     /* link.next is 'prev' */
+
+	rcu_item * prev() const { return (rcu_item*)link.next; }
+	void prev(rcu_item * p) { link.next = (ebr_node*)p; }
+};
+
+/*
+ *	Reader's iterator
+ */
+template <typename I>
+struct rcu_iter
+{
+	I * p;
+
+	rcu_iter(I * first) : p(first) { }
+
+	auto operator * () const -> decltype(container_of((I*)0)) { return container_of(p); }
+
+	rcu_iter & operator ++ ()
+	{
+		p = p->next.load(std::memory_order_acquire);
+		return *this;
+	}
+
+	bool operator != (const rcu_iter & other) const { return p != other.p; }
+};
+
+/*
+ *	Read-mostly doubly-linked list
+ *
+ *	This is the Linux list_*_rcu() scheme. Readers traverse the
+ *	list concurrently with writers and without taking any locks
+ *	or doing any atomic RMW - the loads are plain loads on x86 -
+ *
+ *		{
+ *			ebr_guard g;
+ *
+ *			for (foo * p : list)
+ *				...
+ *		}
+ *
+ *	With ebr_online() threads don't even need the guard, see
+ *	ebr.h.
+ *
+ *	Writers must be serialized, e.g. with a mutex. Items are
+ *	published with a release store, so readers see them fully
+ *	initialized. del() leaves the item's 'next' intact, so that
+ *	readers that are on it can carry on, and retires the item.
+ *	It is passed to D::dispose() once all readers are done
+ *	with it. A removed item can't be re-added before then.
+ *
+ *	Writers don't need a guard. del() relies on the fence that
+ *	ebr_retire() does between the unlink and reading the epoch,
+ *	which is what keeps readers of later epochs off the item.
+ *
+ *	Items that are still on the list when it's destroyed are
+ *	not disposed of.
+ */
+template <typename I, typename T, typename D = ebr_delete<T> >
+struct rcu_head
+{
+	typedef rcu_item<I> item;
+
+	std::atomic<item *> first;
+
+	rcu_head() : first(NULL) { }
+
+	rcu_head(const rcu_head &) = delete;
+	rcu_head & operator = (const rcu_head &) = delete;
+
+	bool empty() const { return ! first.load(std::memory_order_relaxed); }
+
+	/*
+	 *	Writers
+	 */
+	void add(item * it)
+	{
+		item * n = first.load(std::memory_order_relaxed);
+
+		it->prev(NULL);
+		it->next.store(n, std::memory_order_relaxed);
+		if (n) n->prev(it);
+
+		first.store(it, std::memory_order_release);
+	}
+
+	void insert_after(item * pos, item * it)
+	{
+		item * n = pos->next.load(std::memory_order_relaxed);
+
+		it->prev(pos);
+		it->next.store(n, std::memory_order_relaxed);
+		if (n) n->prev(it);
+
+		pos->next.store(it, std::memory_order_release);
+	}
+
+	void del(item * it)
+	{
+		item * n = it->next.load(std::memory_order_relaxed);
+		item * p = it->prev();
+
+		if (p) p->next.store(n, std::memory_order_release);
+		else   first.store(n, std::memory_order_release);
+
+		if (n) n->prev(p);
+
+		it->link.invoke = reclaim;
+		ebr_retire_node(&it->link);
+	}
+
+	/*
+	 *	Readers
+	 */
+	rcu_iter<item> begin() const { return first.load(std::memory_order_acquire); }
+	rcu_iter<item> end()   const { return NULL; }
+
+	/*
+	 *	Internals
+	 */
+	static void reclaim(ebr_node * n)
+	{
+		item * it = (item*)((char*)n - offsetof(item, link));
+		D::dispose(container_of(it));
+	}
+};
+
+/*
+ *	The boilerplate, same as for the lists
+ */
+#define RCU_ITEM          RCU_ITEM_1(__LINE__)
+#define RCU_ITEM_1(inst)  RCU_ITEM_2(inst)
+#define RCU_ITEM_2(inst)  struct rcu_inst_ ## inst { }; \
+                          rcu_item<rcu_inst_ ## inst>
+
+template <typename T>
+auto template_arg(rcu_item<T> &) -> T;
+
+#define RCU_HEAD_TYPE(T, field, ...)  rcu_head<decltype(template_arg(T::field)), T, ##__VA_ARGS__>
+#define RCU_ITEM_TYPE(T, field)       rcu_item<decltype(template_arg(T::field))>
+
+/*
+ *	RCU_HEAD(T, field [, disposer])
+ */
+#define RCU_HEAD(T, field, ...)  RCU_HEAD_TYPE(T, field, ##__VA_ARGS__)
+
+#endif
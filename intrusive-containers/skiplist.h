@@ -0,0 +1,357 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _SKIPLIST_H_
+#define _SKIPLIST_H_
+
+#include "linked_list.h"    /* template_arg(), CONTAINER_OF() */
+#include "ebr.h"
+
+#include <stdint.h>
+#include <atomic>
+
+/*
+ *	Skip list item
+ *
+ *	The tower of 'next' links is embedded, so the item is large -
+ *	SKIP_LEVELS pointers plus the EBR link, 128 bytes in total on
+ *	64-bit systems. The links have their lowest bit set when the
+ *	item is being deleted.
+ *
+ *	With 1/4 chance of going up a level, 12 levels are good for
+ *	up to about 16 million items.
+ */
+#define SKIP_LEVELS  12
+
+template <typename T>
+struct skip_item
+{
+	std::atomic<uintptr_t>  next[SKIP_LEVELS];
+	std::atomic<int>        state;
+	int                     height;
+	ebr_item<T>             retire;
+};
+
+template <typename K>
+struct skip_less
+{
+	static bool less(const K & a, const K & b) { return a < b; }
+};
+
+/*
+ *	Lock-free skip list head
+ *
+ *	This is a concurrent ordered map, keyed by T's 'key' field,
+ *	which must not change while the item is on the list. Keys are
+ *	unique and add() fails if the key is already there.
+ *
+ *	This is the Herlihy-Shavit design. The items are linked into
+ *	the bottom level first and that's what makes them present,
+ *	the upper levels are just shortcuts. Deletion is logical then
+ *	physical - del() marks the item's links, top to bottom, and
+ *	whoever marks the bottom one owns the deletion. Then the item
+ *	is unlinked, by del(), by its own add() if that is still in
+ *	progress, or by any add() passing through.
+ *
+ *	find(), first() and next() don't write anything.
+ *
+ *	Removed items are retired with EBR and passed to D::dispose()
+ *	once no thread can have them, so pointers returned by find()
+ *	and the others remain valid until the caller exits its guard -
+ *
+ *		{
+ *			ebr_guard g;
+ *
+ *			for (auto p = map.first(); p; p = map.next(p))
+ *				container_of(p)->...
+ *		}
+ *
+ *	Items that are still on the list when it's destroyed are
+ *	not disposed of.
+ */
+template <typename I, typename T, typename K, K T::*key,
+          typename C = skip_less<K>, typename D = ebr_delete<T> >
+struct skip_head
+{
+	typedef skip_item<I> item;
+
+	/*
+	 *	add() sets LINKED once it's done linking the levels and
+	 *	del() sets UNLINKED once it's done marking them. Whoever
+	 *	comes second sees all of the other's writes through the
+	 *	RMW on 'state', so it does the final unlinking and retires
+	 *	the item.
+	 */
+	enum { LINKED = 1, UNLINKED = 2 };
+
+	item                 head;
+	std::atomic<size_t>  count;
+
+	skip_head() : count(0)
+	{
+		for (auto & n : head.next)
+			n.store(0, std::memory_order_relaxed);
+	}
+
+	skip_head(const skip_head &) = delete;
+	skip_head & operator = (const skip_head &) = delete;
+
+	size_t size() const { return count.load(std::memory_order_relaxed); }
+
+	/*
+	 *	Returns false if the key is already on the list
+	 */
+	bool add(item * it)
+	{
+		ebr_guard g;
+		const K & k = key_of(it);
+		item * preds[SKIP_LEVELS];
+		item * succs[SKIP_LEVELS];
+		uintptr_t exp;
+		int l, h;
+
+		it->height = h = random_height();
+		it->state.store(0, std::memory_order_relaxed);
+
+		for (;;)
+		{
+			if (locate(k, preds, succs))
+				return false;
+
+			for (l = 0; l < h; l++)
+				it->next[l].store((uintptr_t)succs[l], std::memory_order_relaxed);
+
+			exp = (uintptr_t)succs[0];
+			if (preds[0]->next[0].compare_exchange_strong(exp, (uintptr_t)it, std::memory_order_release,
+			                                                                   std::memory_order_relaxed))
+				break;
+		}
+
+		count.fetch_add(1, std::memory_order_relaxed);
+
+		for (l = 1; l < h; l++)
+		{
+			for (;;)
+			{
+				exp = (uintptr_t)succs[l];
+				if (preds[l]->next[l].compare_exchange_strong(exp, (uintptr_t)it, std::memory_order_release,
+				                                                                   std::memory_order_relaxed))
+					break;
+
+				locate(k, preds, succs);
+
+				/* re-point our link, unless it's been marked */
+				exp = it->next[l].load(std::memory_order_relaxed);
+				if ((exp & 1) ||
+				    ! it->next[l].compare_exchange_strong(exp, (uintptr_t)succs[l], std::memory_order_relaxed))
+					goto done;
+			}
+		}
+	done:
+		/* deleted while we were linking, unlink the rest of it */
+		if (it->state.fetch_or(LINKED, std::memory_order_acq_rel) & UNLINKED)
+		{
+			locate(k, NULL, NULL);
+			retire(it);
+		}
+
+		return true;
+	}
+
+	/*
+	 *	Returns false if someone else has deleted the item first
+	 */
+	bool del(item * it)
+	{
+		ebr_guard g;
+		int l;
+
+		for (l = it->height - 1; l > 0; l--)
+			it->next[l].fetch_or(1, std::memory_order_acq_rel);
+
+		if (it->next[0].fetch_or(1, std::memory_order_acq_rel) & 1)
+			return false;
+
+		count.fetch_sub(1, std::memory_order_relaxed);
+
+		/* otherwise add() is still at it and it will finish up */
+		if (it->state.fetch_or(UNLINKED, std::memory_order_acq_rel) & LINKED)
+		{
+			locate(key_of(it), NULL, NULL);
+			retire(it);
+		}
+
+		return true;
+	}
+
+	/*
+	 *	These need to be called in an ebr_guard scope, see above
+	 */
+	item * find(const K & k) const
+	{
+		item * p = lower_bound(k);
+		return (p && ! C::less(k, key_of(p))) ? p : NULL;
+	}
+
+	item * lower_bound(const K & k) const
+	{
+		const item * pred = &head;
+		item * curr = NULL;
+		uintptr_t v;
+
+		for (int l = SKIP_LEVELS - 1; l >= 0; l--)
+		{
+			curr = ptr(pred->next[l].load(std::memory_order_acquire));
+
+			while (curr)
+			{
+				v = curr->next[l].load(std::memory_order_acquire);
+
+				if (v & 1)                     /* skip over deleted */
+					curr = ptr(v);
+				else
+				if (C::less(key_of(curr), k))
+					pred = curr, curr = ptr(v);
+				else
+					break;
+			}
+		}
+
+		return curr;
+	}
+
+	item * first() const { return live(ptr(head.next[0].load(std::memory_order_acquire))); }
+
+	static item * next(const item * it) { return live(ptr(it->next[0].load(std::memory_order_acquire))); }
+
+	/*
+	 *	Internals
+	 */
+	static item * ptr(uintptr_t v) { return (item*)(v & ~(uintptr_t)1); }
+
+	static const K & key_of(const item * it) { return container_of((item*)it)->*key; }
+
+	static item * live(item * p)
+	{
+		uintptr_t v;
+
+		while (p && ((v = p->next[0].load(std::memory_order_acquire)) & 1))
+			p = ptr(v);
+
+		return p;
+	}
+
+	/*
+	 *	Finds the last item before 'k' and the first one at or after
+	 *	it on every level, unlinking deleted items on the way. Returns
+	 *	true if the latter is 'k' on the bottom level.
+	 */
+	bool locate(const K & k, item ** preds, item ** succs)
+	{
+		item * pred, * curr, * succ;
+		uintptr_t v, exp;
+		int l;
+
+	retry:
+		pred = &head;
+		curr = NULL;
+
+		for (l = SKIP_LEVELS - 1; l >= 0; l--)
+		{
+			curr = ptr(pred->next[l].load(std::memory_order_acquire));
+
+			while (curr)
+			{
+				v = curr->next[l].load(std::memory_order_acquire);
+				succ = ptr(v);
+
+				if (v & 1)
+				{
+					/* fails if 'pred' is no longer before 'curr' or is being deleted itself */
+					exp = (uintptr_t)curr;
+					if (! pred->next[l].compare_exchange_strong(exp, (uintptr_t)succ, std::memory_order_acq_rel,
+					                                                                   std::memory_order_acquire))
+						goto retry;
+
+					curr = succ;
+					continue;
+				}
+
+				if (! C::less(key_of(curr), k))
+					break;
+
+				pred = curr;
+				curr = succ;
+			}
+
+			if (preds)
+			{
+				preds[l] = pred;
+				succs[l] = curr;
+			}
+		}
+
+		return curr && ! C::less(k, key_of(curr));
+	}
+
+	static int random_height()
+	{
+		static thread_local uint32_t seed = 0;
+		uint32_t x;
+		int h = 1;
+
+		if (! seed)
+			seed = (uint32_t)(uintptr_t)&seed | 1;
+
+		x = seed;
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		seed = x;
+
+		while (h < SKIP_LEVELS && ! (x & 3))
+			h++, x >>= 2;
+
+		return h;
+	}
+
+	/*
+	 *	Called by del() or add(), whichever is last to be done with
+	 *	the item, so it's off all levels by then
+	 */
+	static void retire(item * it)
+	{
+		ebr_retire(&it->retire, reclaim);
+	}
+
+	static void reclaim(ebr_item<I> * e)
+	{
+		item * it = (item*)((char*)e - offsetof(item, retire));
+		D::dispose(container_of(it));
+	}
+};
+
+/*
+ *	The boilerplate, same as for the lists
+ */
+#define SKIPLIST_ITEM          SKIPLIST_ITEM_1(__LINE__)
+#define SKIPLIST_ITEM_1(inst)  SKIPLIST_ITEM_2(inst)
+#define SKIPLIST_ITEM_2(inst)  struct skip_inst_ ## inst { }; \
+                               skip_item<skip_inst_ ## inst>
+
+template <typename T>
+auto template_arg(skip_item<T> &) -> T;
+
+#define SKIPLIST_HEAD_TYPE(T, field, key_field, ...)              \
+	skip_head<decltype(template_arg(T::field)), T,            \
+	          decltype(T::key_field), &T::key_field, ##__VA_ARGS__>
+
+#define SKIPLIST_ITEM_TYPE(T, field)  skip_item<decltype(template_arg(T::field))>
+
+/*
+ *	SKIPLIST_HEAD(T, field, key_field [, comparator [, disposer]])
+ */
+#define SKIPLIST_HEAD(T, field, key_field, ...)  SKIPLIST_HEAD_TYPE(T, field, key_field, ##__VA_ARGS__)
+
+#endif
@@ -0,0 +1,244 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ *
+ *	g++ -std=c++11 -pthread skiplist_example.cpp
+ */
+#include "skiplist.h"
+#include <assert.h>
+#include <thread>
+#include <vector>
+
+struct node
+{
+	int               key;
+	std::atomic<int>  disposed;
+
+	SKIPLIST_ITEM  link;
+};
+
+CONTAINER_OF(node, link);
+
+/*
+ *	Nodes are static, so disposing of one just marks it
+ */
+struct mark_disposed
+{
+	static void dispose(node * p) { p->disposed++; }
+};
+
+typedef SKIPLIST_HEAD(node, link, key, skip_less<int>, mark_disposed)  node_map;
+
+#define N  1000
+
+static node  nodes[N];
+static node  twins[N];     /* same keys */
+
+static void reset()
+{
+	for (int i = 0; i < N; i++)
+	{
+		nodes[i].key = twins[i].key = i;
+		nodes[i].disposed = twins[i].disposed = 0;
+	}
+}
+
+void test()
+{
+	node_map  map;
+	node      dup;
+	int       i;
+
+	node_map::item * p;
+
+	reset();
+
+	for (i = 0; i < N; i++)
+		assert(map.add(&nodes[(i * 7) % N].link));
+
+	dup.key = 5;
+	assert(! map.add(&dup.link));
+	assert(map.size() == N);
+
+	{
+		ebr_guard g;
+
+		assert(map.find(5) == &nodes[5].link);
+		assert(! map.find(N));
+
+		for (i = 0, p = map.first(); p; p = map.next(p), i++)
+			assert(container_of(p)->key == i);
+
+		assert(i == N);
+	}
+
+	/*
+	 *	only the first del() of an item owns it
+	 */
+	assert(map.del(&nodes[5].link));
+	assert(! map.del(&nodes[5].link));
+
+	{
+		ebr_guard g;
+
+		assert(! map.find(5));
+		assert(map.lower_bound(5) == &nodes[6].link);
+	}
+
+	for (i = 0; i < N; i++)
+		if (i != 5)
+			assert(map.del(&nodes[i].link));
+
+	assert(! map.size());
+
+	ebr_synchronize();
+
+	for (i = 0; i < N; i++)
+		assert(nodes[i].disposed == 1);
+}
+
+/*
+ *	A reader that is in a guard keeps what it has found from being
+ *	disposed of, both for the skip list and for a plain EBR_ITEM
+ */
+struct config
+{
+	int               version;
+	std::atomic<int>  disposed;
+
+	EBR_ITEM  retire;
+};
+
+static void free_config(EBR_ITEM_TYPE(config, retire) * e)
+{
+	((config *)((char*)e - offsetof(config, retire)))->disposed++;
+}
+
+void test_guard()
+{
+	node_map               map;
+	config                 v1, v2;
+	std::atomic<config *>  current(&v1);
+	std::atomic<int>       stage(0);
+	int                    i;
+
+	reset();
+	v1.version = 1, v1.disposed = 0;
+	v2.version = 2, v2.disposed = 0;
+
+	for (i = 0; i < N; i++)
+		map.add(&nodes[i].link);
+
+	std::thread reader([&]
+	{
+		ebr_guard g;
+		auto p = map.find(5);
+		config * c = current.load(std::memory_order_acquire);
+
+		stage = 1;
+		while (stage != 2)
+			std::this_thread::yield();
+
+		/* both are gone, but not freed */
+		assert(container_of(p)->key == 5 && ! container_of(p)->disposed);
+		assert(c->version == 1 && ! c->disposed);
+	});
+
+	while (stage != 1)
+		std::this_thread::yield();
+
+	map.del(&nodes[5].link);
+
+	current.store(&v2, std::memory_order_release);
+	ebr_retire(&v1.retire, free_config);
+
+	/* enough retires to run a few collections */
+	for (i = 6; i < 6 + 4 * EBR_BATCH; i++)
+		map.del(&nodes[i].link);
+
+	assert(nodes[6].disposed == 0);
+
+	stage = 2;
+	reader.join();
+
+	ebr_synchronize();
+
+	assert(nodes[5].disposed == 1 && v1.disposed == 1);
+	assert(nodes[6].disposed == 1 && ! v2.disposed);
+
+	for (i = 0; i < N; i++)
+		if (i < 5 || i >= 6 + 4 * EBR_BATCH)
+			map.del(&nodes[i].link);
+
+	ebr_synchronize();
+}
+
+/*
+ *	Threads race to add the same keys, two per key with their own
+ *	nodes, and then to delete them, while iterating in between.
+ *	Every key ends up added and deleted the same number of times.
+ */
+void test_concurrent()
+{
+	node_map  map;
+	std::vector<std::thread>  threads;
+	std::atomic<int>  added(0), deleted(0);
+	int  in[2][N] = { };
+	int  t, i;
+
+	reset();
+
+	for (t = 0; t < 4; t++)
+		threads.emplace_back([&, t]
+		{
+			node * own = (t < 2) ? nodes : twins;
+			int i, n;
+
+			for (i = t & 1; i < N; i += 2)
+				if (map.add(&own[i].link))
+					in[t < 2 ? 0 : 1][i] = 1, added++;
+
+			for (n = 0; n < 10; n++)
+			{
+				ebr_guard g;
+
+				for (auto p = map.first(); p; )
+				{
+					auto q = map.next(p);
+					assert(! q || container_of(p)->key < container_of(q)->key);
+					p = q;
+				}
+			}
+
+			/* both threads of the key may find the same node */
+			for (i = t & 1; i < N; i += 2)
+			{
+				ebr_guard g;
+				auto p = map.find(i);
+
+				if (p && map.del(p))
+					deleted++;
+			}
+
+			ebr_synchronize();
+		});
+
+	for (auto & th : threads)
+		th.join();
+
+	ebr_synchronize();
+
+	assert(added >= N && added == deleted);
+	assert(! map.size());
+
+	for (i = 0; i < N; i++)
+		assert(nodes[i].disposed == in[0][i] && twins[i].disposed == in[1][i]);
+}
+
+int main()
+{
+	test();
+	test_guard();
+	test_concurrent();
+	return 0;
+}
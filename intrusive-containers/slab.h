@@ -0,0 +1,176 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _SLAB_H_
+#define _SLAB_H_
+
+#include "linked_list.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <new>
+#include <utility>
+
+/*
+ *	Slab allocator for fixed-size objects
+ *
+ *	Objects are carved out of large chunks with a pointer bump.
+ *	Freed slots are put on a freelist that is threaded through
+ *	the slots themselves, using list_item, so alloc() is either
+ *	a freelist pop or a bump and free() is a freelist push.
+ *
+ *		slab<foo>  foos;
+ *
+ *		foo * p = foos.create(...);   // alloc() + constructor
+ *		...
+ *		foos.destroy(p);              // destructor + free()
+ *
+ *	reset() forgets all objects at once in O(1) and makes the
+ *	memory available for reuse. It doesn't call destructors, so
+ *	it's for objects that need no cleanup - or that are torn
+ *	down together, e.g. all items of a container that is itself
+ *	being discarded. The chunks are kept for reuse and are only
+ *	freed by release() or by the destructor.
+ *
+ *	The slab is not thread-safe. Use thread_slab<T>() to get one
+ *	per thread, but then the objects must be freed by the same
+ *	thread that allocated them.
+ */
+#define SLAB_CHUNK_SLOTS  256
+
+template <typename T>
+struct slab
+{
+	union slot
+	{
+		list_item< slab<T> > free;
+		alignas(T) char      data[sizeof(T)];
+	};
+
+	struct chunk
+	{
+		chunk * next;
+		slot  * slots;
+	};
+
+	chunk  * chunks;      /* all chunks, in allocation order    */
+	chunk  * current;     /* the chunk we are bumping through   */
+	slot   * bump;
+	slot   * bump_end;
+	size_t   per_chunk;
+
+	list_head< slab<T> > freelist;
+
+	slab(size_t slots_per_chunk = SLAB_CHUNK_SLOTS)
+		: chunks(NULL), current(NULL), bump(NULL), bump_end(NULL), per_chunk(slots_per_chunk) { }
+
+	~slab() { release(); }
+
+	slab(const slab &) = delete;
+	slab & operator = (const slab &) = delete;
+
+	/*
+	 *	Raw memory for a T, or NULL if out of memory
+	 */
+	void * alloc()
+	{
+		list_item< slab<T> > * p;
+
+		if ((p = freelist.pop()))
+			return p;
+
+		if (bump == bump_end && ! next_chunk())
+			return NULL;
+
+		return bump++;
+	}
+
+	void free(void * ptr)
+	{
+		freelist.add( new (ptr) list_item< slab<T> >() );
+	}
+
+	template <typename... A>
+	T * create(A && ... args)
+	{
+		void * ptr = alloc();
+		return ptr ? new (ptr) T(std::forward<A>(args)...) : NULL;
+	}
+
+	void destroy(T * obj)
+	{
+		obj->~T();
+		free(obj);
+	}
+
+	/*
+	 *	Bulk ops
+	 */
+	void reset()
+	{
+		freelist = list_head< slab<T> >();
+		current = NULL;
+		bump = bump_end = NULL;
+	}
+
+	void release()
+	{
+		chunk * c, * n;
+
+		for (c = chunks; c; c = n)
+		{
+			n = c->next;
+			::free(c);
+		}
+
+		chunks = NULL;
+		reset();
+	}
+
+	/*
+	 *	Internals
+	 */
+	bool next_chunk()
+	{
+		chunk * c;
+
+		/* reuse chunks that were kept after reset() */
+		c = current ? current->next : chunks;
+
+		if (! c)
+		{
+			uintptr_t p;
+
+			c = (chunk*)malloc(sizeof(chunk) + alignof(slot) + per_chunk * sizeof(slot));
+			if (! c)
+				return false;
+
+			p = (uintptr_t)(c + 1);
+			p = (p + alignof(slot) - 1) & ~(uintptr_t)(alignof(slot) - 1);
+
+			c->next = NULL;
+			c->slots = (slot*)p;
+
+			if (current) current->next = c;
+			else         chunks = c;
+		}
+
+		current = c;
+		bump = c->slots;
+		bump_end = c->slots + per_chunk;
+		return true;
+	}
+};
+
+/*
+ *	Per-thread slab
+ */
+template <typename T>
+slab<T> & thread_slab()
+{
+	static thread_local slab<T> instance;
+	return instance;
+}
+
+#endif
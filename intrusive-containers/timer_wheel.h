@@ -0,0 +1,225 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _TIMER_WHEEL_H_
+#define _TIMER_WHEEL_H_
+
+#include "linked_list.h"
+
+#include <stdint.h>
+
+/*
+ *	Timer item
+ *
+ *	'link' is first, so the item can be recovered from it with
+ *	a cast. 'slot' is the list the timer is on, so that it can
+ *	be canceled in O(1), NULL if the timer is not pending.
+ */
+template <typename T>
+struct timer_item
+{
+	dlist_item<T>   link;
+	dlist_head<T> * slot;
+	uint64_t        expires;
+
+	timer_item() : slot(NULL), expires(0) { }
+};
+
+/*
+ *	Hierarchical timing wheel
+ *
+ *	This is the classic, pre-4.8 Linux kernel design. The first
+ *	level has a slot for each of the next 256 ticks, the higher
+ *	levels have 64 slots each and each slot covers 64x the range
+ *	of the level below. When the first level wraps around, the
+ *	next slot of the level above is "cascaded" - its timers are
+ *	re-added and land on the lower levels.
+ *
+ *	schedule() and cancel() are O(1). A timer is re-added at most
+ *	once per level before it expires, so the firing is amortized
+ *	O(1) per timer too.
+ *
+ *	4 levels cover 2^26 ticks, e.g. 18 hours at 1 ms ticks. More
+ *	distant timers are parked in the last slot of the top level
+ *	and re-parked as needed.
+ *
+ *	Time is in abstract ticks. 'now' is the next tick that will
+ *	be processed, so timers that are scheduled in the past are
+ *	run on it.
+ */
+#define TW_ROOT_BITS   8
+#define TW_LEVEL_BITS  6
+#define TW_LEVELS      3   /* above the root */
+
+#define TW_ROOT_SIZE   (1 << TW_ROOT_BITS)
+#define TW_LEVEL_SIZE  (1 << TW_LEVEL_BITS)
+
+#define TW_MAX_DELTA   ((1ULL << (TW_ROOT_BITS + TW_LEVELS * TW_LEVEL_BITS)) - 1)
+
+template <typename T>
+struct timer_wheel
+{
+	typedef timer_item<T>  item;
+	typedef dlist_head<T>  slot_list;
+
+	uint64_t   now;
+	size_t     count;
+	slot_list  root[TW_ROOT_SIZE];
+	slot_list  level[TW_LEVELS][TW_LEVEL_SIZE];
+
+	timer_wheel(uint64_t now_ = 0) : now(now_), count(0) { }
+
+	timer_wheel(const timer_wheel &) = delete;
+	timer_wheel & operator = (const timer_wheel &) = delete;
+
+	size_t size() const { return count; }
+
+	static bool pending(const item * t) { return t->slot != NULL; }
+
+	/*
+	 *	Schedules the timer or, if it's already pending, moves it
+	 *	to the new expiry time
+	 */
+	void schedule(item * t, uint64_t expires)
+	{
+		if (pending(t))
+			cancel(t);
+
+		t->expires = expires;
+		place(t);
+		count++;
+	}
+
+	void cancel(item * t)
+	{
+		if (! pending(t))
+			return;
+
+		t->slot->del(&t->link);
+		t->slot = NULL;
+		count--;
+	}
+
+	/*
+	 *	Processes all ticks up to and including 'to', calls 'fire'
+	 *	with each expired timer's struct. The timers of the same
+	 *	tick are taken off the wheel together and then fired, so
+	 *	'fire' is free to schedule and cancel any timers, including
+	 *	re-scheduling the one it's called for.
+	 */
+	template <typename F>
+	void advance(uint64_t to, F fire)
+	{
+		slot_list batch;
+		dlist_item<T> * p;
+		item * t;
+
+		while (now <= to)
+		{
+			size_t i = now & (TW_ROOT_SIZE - 1);
+
+			if (! i)
+				cascade(0);
+
+			now++;
+
+			if (root[i].empty())
+				continue;
+
+			batch.splice(root[i]);
+
+			for (p = batch.first; p; p = p->next)
+				((item*)p)->slot = &batch;
+
+			while ((p = batch.first))
+			{
+				t = (item*)p;
+				cancel(t);
+				fire(container_of(t));
+			}
+		}
+	}
+
+	/*
+	 *	Internals
+	 */
+	void place(item * t)
+	{
+		uint64_t e = t->expires;
+		uint64_t delta;
+		slot_list * s;
+
+		if (e < now)
+			e = now;
+
+		delta = e - now;
+
+		if (delta > TW_MAX_DELTA)
+			e = now + (delta = TW_MAX_DELTA);
+
+		if (delta < TW_ROOT_SIZE)
+		{
+			s = root + (e & (TW_ROOT_SIZE - 1));
+		}
+		else
+		{
+			int n = 0;
+
+			while (delta >> (TW_ROOT_BITS + (n+1) * TW_LEVEL_BITS))
+				n++;
+
+			s = level[n] + ((e >> (TW_ROOT_BITS + n * TW_LEVEL_BITS)) & (TW_LEVEL_SIZE - 1));
+		}
+
+		s->add_tail(&t->link);
+		t->slot = s;
+	}
+
+	/*
+	 *	Called when level 'n-1' (or the root) wraps around. This
+	 *	re-adds the timers of the current slot of level 'n' and,
+	 *	if that one wrapped around too, cascades the level above
+	 *	first.
+	 */
+	void cascade(int n)
+	{
+		size_t i;
+		slot_list batch;
+		dlist_item<T> * p;
+
+		if (n == TW_LEVELS)
+			return;
+
+		i = (now >> (TW_ROOT_BITS + n * TW_LEVEL_BITS)) & (TW_LEVEL_SIZE - 1);
+
+		if (! i)
+			cascade(n+1);
+
+		batch.splice(level[n][i]);
+
+		while ((p = batch.first))
+		{
+			batch.del(p);
+			place((item*)p);
+		}
+	}
+};
+
+/*
+ *	The boilerplate, same as for the lists
+ */
+#define TIMER_ITEM          TIMER_ITEM_1(__LINE__)
+#define TIMER_ITEM_1(inst)  TIMER_ITEM_2(inst)
+#define TIMER_ITEM_2(inst)  struct timer_inst_ ## inst { }; \
+                            timer_item<timer_inst_ ## inst>
+
+template <typename T>
+auto template_arg(timer_item<T> &) -> T;
+
+#define TIMER_WHEEL_TYPE(T, field)  timer_wheel<decltype(template_arg(T::field))>
+#define TIMER_ITEM_TYPE(T, field)   timer_item<decltype(template_arg(T::field))>
+
+#define TIMER_WHEEL(T, field)  TIMER_WHEEL_TYPE(T, field)
+
+#endif
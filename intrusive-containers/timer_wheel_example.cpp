@@ -0,0 +1,132 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ *
+ *	g++ -std=c++11 timer_wheel_example.cpp
+ */
+#include "timer_wheel.h"
+#include <assert.h>
+
+struct conn
+{
+	uint64_t  deadline;
+	uint64_t  fired_at;
+	int       fired;
+
+	TIMER_ITEM  timeout;
+};
+
+CONTAINER_OF(conn, timeout);
+
+#define START  1000
+
+/*
+ *	Around the points where the root and then each level wrap,
+ *	so the timers cascade down on the way, and where they start
+ *	going onto the next level up, plus a few that are in the past
+ *	and beyond the wheel's range
+ */
+static const uint64_t deadlines[] =
+{
+	0, START - 1, START, START + 1,
+	1023, 1024, 1025, 1279, 1280,
+	(1 << 14) - 1, 1 << 14, (1 << 14) + 1,
+	(1 << 20) - 1, 1 << 20, (1 << 20) + 1,
+	START + (1 << 8) - 1,  START + (1 << 8),
+	START + (1 << 14) - 1, START + (1 << 14),
+	START + (1 << 20) - 1, START + (1 << 20),
+	START + TW_MAX_DELTA, START + TW_MAX_DELTA + 1, START + TW_MAX_DELTA + 5000,
+};
+
+#define N  (sizeof deadlines / sizeof deadlines[0])
+
+static conn  c[N];
+
+void test()
+{
+	TIMER_WHEEL(conn, timeout)  wheel(START);
+	size_t  i;
+
+	for (i = 0; i < N; i++)
+	{
+		c[i].deadline = deadlines[i];
+		wheel.schedule(&c[i].timeout, c[i].deadline);
+	}
+
+	/*
+	 *	every timer fires exactly on its tick, or on the first one
+	 *	if it's in the past, no matter how the ticks are advanced
+	 */
+	while (wheel.size())
+	{
+		uint64_t step = (wheel.now < 20000) ? 1 : 77777;
+
+		wheel.advance(wheel.now + step - 1, [&](conn * p)
+		{
+			p->fired_at = wheel.now - 1;
+			p->fired++;
+		});
+	}
+
+	for (i = 0; i < N; i++)
+	{
+		assert(c[i].fired == 1);
+		assert(c[i].fired_at == (c[i].deadline < START ? START : c[i].deadline));
+		assert(! wheel.pending(&c[i].timeout));
+	}
+}
+
+void test_callbacks()
+{
+	TIMER_WHEEL(conn, timeout)  wheel;
+	static conn  a, b, periodic;
+	int  n = 0;
+
+	/*
+	 *	'a' cancels 'b' of the same tick, 'periodic' re-arms itself
+	 */
+	wheel.schedule(&a.timeout, 300);
+	wheel.schedule(&b.timeout, 300);
+	wheel.schedule(&periodic.timeout, 100);
+
+	wheel.advance(10000, [&](conn * p)
+	{
+		p->fired++;
+
+		if (p == &a)
+			wheel.cancel(&b.timeout);
+
+		if (p == &periodic)
+		{
+			assert(wheel.now - 1 == 100 * (uint64_t)++n);
+			if (n < 50)
+				wheel.schedule(&p->timeout, wheel.now - 1 + 100);
+		}
+	});
+
+	assert(a.fired == 1 && b.fired == 0);
+	assert(periodic.fired == 50);
+	assert(! wheel.size());
+
+	/*
+	 *	cancelling and re-scheduling before the time
+	 */
+	wheel.schedule(&a.timeout, 20000);
+	wheel.schedule(&a.timeout, 10500);
+	wheel.schedule(&b.timeout, 10500);
+	wheel.cancel(&b.timeout);
+	wheel.cancel(&b.timeout);
+	assert(wheel.size() == 1);
+
+	wheel.advance(30000, [&](conn * p){ p->fired_at = wheel.now - 1; p->fired++; });
+
+	assert(a.fired == 2 && a.fired_at == 10500);
+	assert(b.fired == 0);
+}
+
+int main()
+{
+	test();
+	test_callbacks();
+	return 0;
+}
@@ -0,0 +1,226 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ */
+#ifndef _WSDEQUE_H_
+#define _WSDEQUE_H_
+
+#include "linked_list.h"    /* template_arg(), CONTAINER_OF() */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <atomic>
+
+/*
+ *	Work-stealing deque item
+ *
+ *	The deque is a ring of pointers, so the item carries no
+ *	linkage. It's there to give the deque a distinct type per
+ *	(struct, field) and to have something to container_of().
+ */
+template <typename T>
+struct wsdeque_item
+{
+};
+
+/*
+ *	Work-stealing deque (Chase-Lev)
+ *
+ *	The owner thread push()es and pop()s at the bottom, LIFO, any
+ *	other thread may steal() from the top, FIFO. This is the C11
+ *	version of the algorithm from "Correct and Efficient Work-
+ *	Stealing for Weak Memory Models" by Le, Pop, Cohen and Zappa
+ *	Nardelli.
+ *
+ *	The ring is grown 2x when it's full. Thieves may still be
+ *	reading from the old ring, so the old rings are kept around
+ *	until the deque is destroyed. Their total size is less than
+ *	that of the current ring. If the ring can't be grown, push()
+ *	fails.
+ *
+ *	steal() returns NULL both when the deque is empty and when it
+ *	loses a race for the top item, so a NULL from steal() is a
+ *	hint to try another victim rather than a sign of no work.
+ */
+#define WSDEQUE_INITIAL_SIZE  64
+
+template <typename T>
+struct wsdeque_head
+{
+	typedef wsdeque_item<T> item;
+
+	struct ring
+	{
+		int64_t              mask;
+		ring               * retired;   /* the previous ring */
+		std::atomic<item*> * slot;
+	};
+
+	alignas(64)
+	std::atomic<int64_t> top;           /* steal() end     */
+
+	alignas(64)
+	std::atomic<int64_t> bottom;        /* push/pop() end  */
+	std::atomic<ring*>   array;
+
+	wsdeque_head() : top(0), bottom(0)
+	{
+		array.store(alloc_ring(WSDEQUE_INITIAL_SIZE, NULL), std::memory_order_relaxed);
+	}
+
+	~wsdeque_head()
+	{
+		ring * r, * prev;
+
+		for (r = array.load(std::memory_order_relaxed); r; r = prev)
+		{
+			prev = r->retired;
+			free(r);
+		}
+	}
+
+	wsdeque_head(const wsdeque_head &) = delete;
+	wsdeque_head & operator = (const wsdeque_head &) = delete;
+
+	/*
+	 *	Owner only
+	 */
+	bool push(item * it)
+	{
+		int64_t b = bottom.load(std::memory_order_relaxed);
+		int64_t t = top.load(std::memory_order_acquire);
+		ring  * a = array.load(std::memory_order_relaxed);
+
+		if (! a || b - t > a->mask)
+		{
+			if (! (a = grow(a, t, b)))
+				return false;
+		}
+
+		a->slot[b & a->mask].store(it, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	item * pop()
+	{
+		int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+		ring  * a = array.load(std::memory_order_relaxed);
+		int64_t t;
+		item  * it;
+
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		t = top.load(std::memory_order_relaxed);
+
+		if (t > b)
+		{
+			/* empty */
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return NULL;
+		}
+
+		it = a->slot[b & a->mask].load(std::memory_order_relaxed);
+
+		if (t == b)
+		{
+			/* the last item, race thieves for it */
+			if (! top.compare_exchange_strong(t, t + 1,
+			                                  std::memory_order_seq_cst,
+			                                  std::memory_order_relaxed))
+				it = NULL;
+
+			bottom.store(b + 1, std::memory_order_relaxed);
+		}
+
+		return it;
+	}
+
+	/*
+	 *	Any thread
+	 */
+	item * steal()
+	{
+		int64_t t = top.load(std::memory_order_acquire);
+		int64_t b;
+		ring  * a;
+		item  * it;
+
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		b = bottom.load(std::memory_order_acquire);
+
+		if (t >= b)
+			return NULL;
+
+		a = array.load(std::memory_order_acquire);
+		it = a->slot[t & a->mask].load(std::memory_order_relaxed);
+
+		if (! top.compare_exchange_strong(t, t + 1,
+		                                  std::memory_order_seq_cst,
+		                                  std::memory_order_relaxed))
+			return NULL;
+
+		return it;
+	}
+
+	size_t size() const  /* approximate */
+	{
+		int64_t b = bottom.load(std::memory_order_relaxed);
+		int64_t t = top.load(std::memory_order_relaxed);
+		return b > t ? (size_t)(b - t) : 0;
+	}
+
+	/*
+	 *	Internals
+	 */
+	static ring * alloc_ring(int64_t size, ring * retired)
+	{
+		ring * r;
+
+		/* std::atomic<item*> is trivially constructible, so calloc() will do */
+		r = (ring*)calloc(1, sizeof(ring) + size * sizeof(std::atomic<item*>));
+		if (! r)
+			return NULL;
+
+		r->mask = size - 1;
+		r->retired = retired;
+		r->slot = (std::atomic<item*> *)(r + 1);
+		return r;
+	}
+
+	ring * grow(ring * a, int64_t t, int64_t b)
+	{
+		ring  * r;
+		int64_t i;
+
+		r = alloc_ring(a ? 2*(a->mask + 1) : WSDEQUE_INITIAL_SIZE, a);
+		if (! r)
+			return NULL;
+
+		for (i = t; i < b; i++)
+			r->slot[i & r->mask].store(a->slot[i & a->mask].load(std::memory_order_relaxed),
+			                           std::memory_order_relaxed);
+
+		array.store(r, std::memory_order_release);
+		return r;
+	}
+};
+
+/*
+ *	The boilerplate, same as for the lists
+ */
+#define WSDEQUE_ITEM          WSDEQUE_ITEM_1(__LINE__)
+#define WSDEQUE_ITEM_1(inst)  WSDEQUE_ITEM_2(inst)
+#define WSDEQUE_ITEM_2(inst)  struct wsdeque_inst_ ## inst { }; \
+                              wsdeque_item<wsdeque_inst_ ## inst>
+
+template <typename T>
+auto template_arg(wsdeque_item<T> &) -> T;
+
+#define WSDEQUE_HEAD_TYPE(T, field)  wsdeque_head<decltype(template_arg(T::field))>
+#define WSDEQUE_ITEM_TYPE(T, field)  wsdeque_item<decltype(template_arg(T::field))>
+
+#define WSDEQUE_HEAD(T, field)  WSDEQUE_HEAD_TYPE(T, field)
+
+#endif
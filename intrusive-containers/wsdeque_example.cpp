@@ -0,0 +1,185 @@
+/*
+ *	C-style intrusive containers in C++
+ *	https://github.com/apankrat/notes/blob/master/intrusive-containers
+ *
+ *	A toy fork-join scheduler - a binary tree of tasks where each
+ *	task spawns two children - run with per-worker work-stealing
+ *	deques and with a single shared mutex-protected queue.
+ *
+ *	g++ -O2 -std=c++11 -pthread wsdeque_example.cpp
+ */
+#include "wsdeque.h"
+#include <stdio.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <chrono>
+
+struct task
+{
+	int  depth;
+
+	WSDEQUE_ITEM  ws;      /* for the work-stealing scheduler */
+	LIST_ITEM     shared;  /* for the shared queue            */
+};
+
+CONTAINER_OF(task, ws);
+CONTAINER_OF(task, shared);
+
+/*
+ *	All tasks are preallocated, spawn() just takes the next one
+ */
+#define TREE_DEPTH  18
+#define TASK_WORK   2000
+
+static std::vector<task>  tasks( (2 << TREE_DEPTH) - 1 );
+static std::atomic<long>  spawned;
+static std::atomic<long>  completed;
+
+static task * spawn(int depth)
+{
+	task * t = &tasks[ spawned++ ];
+	t->depth = depth;
+	return t;
+}
+
+static void work()
+{
+	volatile unsigned x = 0;
+	for (int i = 0; i < TASK_WORK; i++)
+		x = x * 31 + i;
+}
+
+static void reset()
+{
+	spawned = 0;
+	completed = 0;
+}
+
+/*
+ *	Work-stealing
+ */
+static void run_stealing(int workers)
+{
+	std::vector<WSDEQUE_HEAD(task, ws)> deques(workers);
+	std::vector<std::thread> threads;
+
+	deques[0].push( &spawn(TREE_DEPTH)->ws );
+
+	for (int i = 0; i < workers; i++)
+		threads.emplace_back([&, i]
+		{
+			unsigned victim = i;
+
+			while (completed < (long)tasks.size())
+			{
+				auto p = deques[i].pop();
+
+				if (! p)
+				{
+					victim = victim * 1103515245 + 12345;
+					p = deques[ (victim >> 8) % workers ].steal();
+					if (! p)
+					{
+						std::this_thread::yield();
+						continue;
+					}
+				}
+
+				task * t = container_of(p);
+				work();
+
+				if (t->depth)
+				{
+					deques[i].push( &spawn(t->depth - 1)->ws );
+					deques[i].push( &spawn(t->depth - 1)->ws );
+				}
+
+				completed++;
+			}
+		});
+
+	for (auto & t : threads)
+		t.join();
+}
+
+/*
+ *	Single shared queue
+ */
+static void run_shared(int workers)
+{
+	LIST_HEAD(task, shared)  queue;
+	std::mutex               lock;
+	std::vector<std::thread> threads;
+
+	queue.add( &spawn(TREE_DEPTH)->shared );
+
+	for (int i = 0; i < workers; i++)
+		threads.emplace_back([&]
+		{
+			while (completed < (long)tasks.size())
+			{
+				LIST_ITEM_TYPE(task, shared) * p;
+
+				lock.lock();
+				p = queue.pop();
+				lock.unlock();
+
+				if (! p)
+				{
+					std::this_thread::yield();
+					continue;
+				}
+
+				task * t = container_of(p);
+				work();
+
+				if (t->depth)
+				{
+					task * a = spawn(t->depth - 1);
+					task * b = spawn(t->depth - 1);
+
+					lock.lock();
+					queue.add(&a->shared);
+					queue.add(&b->shared);
+					lock.unlock();
+				}
+
+				completed++;
+			}
+		});
+
+	for (auto & t : threads)
+		t.join();
+}
+
+template <typename F>
+static double timed(F f, int workers)
+{
+	auto t0 = std::chrono::steady_clock::now();
+
+	reset();
+	f(workers);
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+int main()
+{
+	int cpus = std::thread::hardware_concurrency();
+
+	if (cpus < 1) cpus = 1;
+
+	printf("%ld tasks\n\n", (long)tasks.size());
+	printf("workers   stealing, ms   shared queue, ms\n");
+
+	for (int n = 1; n <= cpus; n *= 2)
+	{
+		double ws = timed(run_stealing, n);
+		double sq = timed(run_shared, n);
+
+		printf("%7d   %12.1f   %16.1f\n", n, ws, sq);
+	}
+
+	return 0;
+}